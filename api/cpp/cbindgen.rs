@@ -75,6 +75,7 @@ fn default_config() -> cbindgen::Config {
         defines: [
             ("target_pointer_width = 64".into(), "SLINT_TARGET_64".into()),
             ("target_pointer_width = 32".into(), "SLINT_TARGET_32".into()),
+            ("feature = binding-profiler".into(), "SLINT_FEATURE_BINDING_PROFILER".into()),
         ]
         .iter()
         .cloned()
@@ -174,6 +175,7 @@ fn gen_corelib(
     config.export.exclude = [
         "SharedString",
         "SharedVector",
+        "SharedVectorAllocator",
         "ImageInner",
         "ImageCacheKey",
         "Image",
@@ -183,6 +185,8 @@ fn gen_corelib(
         "Brush",
         "slint_new_path_elements",
         "slint_new_path_events",
+        "slint_path_data_append_polyline",
+        "slint_path_data_decimated_polyline",
         "Property",
         "Slice",
         "PropertyHandleOpaque",
@@ -203,6 +207,8 @@ fn gen_corelib(
         "slint_image_path",
         "slint_image_load_from_path",
         "slint_image_load_from_embedded_data",
+        "slint_image_decode_from_path",
+        "slint_image_set_decoded_cache_budget",
         "Coord",
         "LogicalRect",
         "LogicalPoint",
@@ -233,8 +239,10 @@ fn gen_corelib(
         .context("Unable to generate bindings for slint_string_internal.h")?
         .write_to_file(include_dir.join("slint_string_internal.h"));
 
+    let mut sharedvector_config = config.clone();
+    sharedvector_config.export.exclude.retain(|x| x != "SharedVectorAllocator");
     cbindgen::Builder::new()
-        .with_config(config.clone())
+        .with_config(sharedvector_config)
         .with_src(crate_dir.join("sharedvector.rs"))
         .with_after_include("namespace slint { template<typename T> struct SharedVector; }")
         .generate()
@@ -256,7 +264,7 @@ fn gen_corelib(
         .with_src(crate_dir.join("properties.rs"))
         .with_src(crate_dir.join("properties/ffi.rs"))
         .with_src(crate_dir.join("callbacks.rs"))
-        .with_after_include("namespace slint { class Color; class Brush; }")
+        .with_after_include("namespace slint { class Color; class Brush; struct SharedString; }")
         .generate()
         .context("Unable to generate bindings for slint_properties_internal.h")?
         .write_to_file(include_dir.join("slint_properties_internal.h"));
@@ -272,9 +280,13 @@ fn gen_corelib(
                 "slint_image_path",
                 "slint_image_load_from_path",
                 "slint_image_load_from_embedded_data",
+                "slint_image_decode_from_path",
+                "slint_image_set_decoded_cache_budget",
                 "SharedPixelBuffer",
                 "SharedImageBuffer",
                 "StaticTextures",
+                "BorrowedOpenGLTexture",
+                "BorrowedOpenGLTextureOrigin",
             ],
             vec!["Color"],
             "slint_image_internal.h",
@@ -287,7 +299,14 @@ fn gen_corelib(
             "",
         ),
         (
-            vec!["PathData", "PathElement", "slint_new_path_elements", "slint_new_path_events"],
+            vec![
+                "PathData",
+                "PathElement",
+                "slint_new_path_elements",
+                "slint_new_path_events",
+                "slint_path_data_append_polyline",
+                "slint_path_data_decimated_polyline",
+            ],
             vec![],
             "slint_pathdata_internal.h",
             "",
@@ -324,14 +343,23 @@ fn gen_corelib(
             "slint_windowrc_set_logical_size",
             "slint_windowrc_set_physical_size",
             "slint_windowrc_dark_color_scheme",
+            "slint_windowrc_set_frame_statistics_history_size",
+            "slint_windowrc_frame_statistics_history",
+            "slint_windowrc_set_frame_statistics_callback",
+            "slint_windowrc_request_animation_frame",
+            "slint_windowrc_cancel_animation_frame",
             "slint_new_path_elements",
             "slint_new_path_events",
+            "slint_path_data_append_polyline",
+            "slint_path_data_decimated_polyline",
             "slint_color_brighter",
             "slint_color_darker",
             "slint_image_size",
             "slint_image_path",
             "slint_image_load_from_path",
             "slint_image_load_from_embedded_data",
+            "slint_image_decode_from_path",
+            "slint_image_set_decoded_cache_budget",
         ]
         .iter()
         .filter(|exclusion| !rust_types.iter().any(|inclusion| inclusion == *exclusion))
@@ -591,6 +619,7 @@ fn gen_interpreter(
         "ValueOpaque",
         "StructOpaque",
         "ModelNotifyOpaque",
+        "PropertyValueUpdate",
     ])
     .map(String::from)
     .collect();
@@ -1,11 +1,33 @@
 # Copyright © SixtyFPS GmbH <info@slint-ui.com>
 # SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-Slint-commercial
 
+# SLINT_TARGET_SOURCES(target [COMPILATION_UNITS count] files...)
+#
+# With COMPILATION_UNITS, the definitions of the generated code are moved out of the header into
+# `count` .cpp files that are added to the target, so that they are compiled once and in parallel
+# instead of in every file that includes the header. The default of 0 generates only the header.
 function(SLINT_TARGET_SOURCES target)
-    foreach (it IN ITEMS ${ARGN})
+    cmake_parse_arguments(_SLINT "" "COMPILATION_UNITS" "" ${ARGN})
+    if (NOT DEFINED _SLINT_COMPILATION_UNITS)
+        set(_SLINT_COMPILATION_UNITS 0)
+    elseif (NOT _SLINT_COMPILATION_UNITS MATCHES "^[0-9]+$")
+        message(FATAL_ERROR "Expected number, got '${_SLINT_COMPILATION_UNITS}' for COMPILATION_UNITS argument")
+    endif()
+
+    foreach (it IN ITEMS ${_SLINT_UNPARSED_ARGUMENTS})
         get_filename_component(_SLINT_BASE_NAME ${it} NAME_WE)
         get_filename_component(_SLINT_ABSOLUTE ${it} REALPATH BASE_DIR ${CMAKE_CURRENT_SOURCE_DIR})
         get_property(_SLINT_STYLE GLOBAL PROPERTY SLINT_STYLE)
+
+        set(_SLINT_CPP_FILES)
+        set(_SLINT_CPP_FILE_ARGS)
+        if (_SLINT_COMPILATION_UNITS GREATER 0)
+            foreach(cpp_num RANGE 1 ${_SLINT_COMPILATION_UNITS})
+                set(_SLINT_CPP_FILE ${CMAKE_CURRENT_BINARY_DIR}/${_SLINT_BASE_NAME}_${cpp_num}.cpp)
+                list(APPEND _SLINT_CPP_FILES ${_SLINT_CPP_FILE})
+                list(APPEND _SLINT_CPP_FILE_ARGS --cpp-file ${_SLINT_CPP_FILE})
+            endforeach()
+        endif()
         if(CMAKE_GENERATOR STREQUAL "Ninja")
             # this code is inspired from the llvm source
             # https://github.com/llvm/llvm-project/blob/a00290ed10a6b4e9f6e9be44ceec367562f270c6/llvm/cmake/modules/TableGen.cmake#L13
@@ -13,10 +35,11 @@ function(SLINT_TARGET_SOURCES target)
             file(RELATIVE_PATH _SLINT_BASE_NAME_REL ${CMAKE_BINARY_DIR} ${CMAKE_CURRENT_BINARY_DIR}/${_SLINT_BASE_NAME})
 
             add_custom_command(
-                OUTPUT ${CMAKE_CURRENT_BINARY_DIR}/${_SLINT_BASE_NAME}.h
+                OUTPUT ${CMAKE_CURRENT_BINARY_DIR}/${_SLINT_BASE_NAME}.h ${_SLINT_CPP_FILES}
                 COMMAND Slint::slint-compiler ${_SLINT_ABSOLUTE}
                     -o ${_SLINT_BASE_NAME_REL}.h  --depfile ${_SLINT_BASE_NAME_REL}.d
                     --style ${_SLINT_STYLE}
+                    ${_SLINT_CPP_FILE_ARGS}
                 DEPENDS Slint::slint-compiler ${_SLINT_ABSOLUTE}
                 COMMENT "Generating ${_SLINT_BASE_NAME}.h"
                 DEPFILE ${CMAKE_CURRENT_BINARY_DIR}/${_SLINT_BASE_NAME}.d
@@ -26,16 +49,17 @@ function(SLINT_TARGET_SOURCES target)
             get_filename_component(_SLINT_DIR ${_SLINT_ABSOLUTE} DIRECTORY )
             file(GLOB ALL_SLINTS "${_SLINT_DIR}/*.slint")
             add_custom_command(
-                OUTPUT ${CMAKE_CURRENT_BINARY_DIR}/${_SLINT_BASE_NAME}.h
+                OUTPUT ${CMAKE_CURRENT_BINARY_DIR}/${_SLINT_BASE_NAME}.h ${_SLINT_CPP_FILES}
                 COMMAND Slint::slint-compiler ${_SLINT_ABSOLUTE}
                     -o ${CMAKE_CURRENT_BINARY_DIR}/${_SLINT_BASE_NAME}.h
                     --style ${_SLINT_STYLE}
+                    ${_SLINT_CPP_FILE_ARGS}
                 DEPENDS Slint::slint-compiler ${_SLINT_ABSOLUTE} ${ALL_SLINTS}
                 COMMENT "Generating ${_SLINT_BASE_NAME}.h"
             )
         endif(CMAKE_GENERATOR STREQUAL "Ninja")
 
-        target_sources(${target} PRIVATE ${CMAKE_CURRENT_BINARY_DIR}/${_SLINT_BASE_NAME}.h)
+        target_sources(${target} PRIVATE ${CMAKE_CURRENT_BINARY_DIR}/${_SLINT_BASE_NAME}.h ${_SLINT_CPP_FILES})
     endforeach()
     target_include_directories(${target} PRIVATE ${CMAKE_CURRENT_BINARY_DIR})
 endfunction()
@@ -9,8 +9,11 @@
 #endif
 
 #include <vector>
+#include <list>
+#include <map>
 #include <memory>
 #include <algorithm>
+#include <cmath>
 #include <iostream> // FIXME: remove: iostream always bring it lots of code so we should not have it in this header
 #include <chrono>
 #include <optional>
@@ -19,6 +22,15 @@
 #include <condition_variable>
 #include <span>
 #include <functional>
+#include <deque>
+#include <atomic>
+#include <limits>
+#include <future>
+#include <iterator>
+#include <concepts>
+#if defined(__cpp_impl_coroutine)
+#    include <coroutine>
+#endif
 
 namespace slint::cbindgen_private {
 // Workaround https://github.com/eqrion/cbindgen/issues/43
@@ -30,6 +42,7 @@ struct ItemVTable;
 #include "slint_point.h"
 #include "slint_backend_internal.h"
 #include "slint_qt_internal.h"
+#include "slint_closure.h"
 
 /// \rst
 /// The :code:`slint` namespace is the primary entry point into the Slint C++ API.
@@ -64,14 +77,22 @@ using cbindgen_private::KeyEvent;
 using cbindgen_private::PointerEvent;
 using cbindgen_private::StandardListViewItem;
 
+/// Set on the threads that run their own event loop, because they registered a platform
+inline thread_local bool is_event_loop_thread = false;
+
 /// Internal function that checks that the API that must be called from the main
 /// thread is indeed called from the main thread, or abort the program otherwise
 ///
 /// Most API should be called from the main thread. When using thread one must
 /// use slint::invoke_from_event_loop
+///
+/// The threads that registered their own platform, see EventLoopContext, are allowed as well.
 inline void assert_main_thread()
 {
 #ifndef NDEBUG
+    if (is_event_loop_thread) {
+        return;
+    }
     static auto main_thread_id = std::this_thread::get_id();
     if (main_thread_id != std::this_thread::get_id()) {
         std::cerr << "A function that should be only called from the main thread was called from a "
@@ -242,6 +263,55 @@ public:
         }
     }
 
+    void prewarm_glyph_cache(const SharedString &family, int weight,
+                             std::span<const float> pixel_sizes,
+                             const SharedString &characters) const
+    {
+        cbindgen_private::slint_prewarm_glyph_cache(
+                &inner, &family, weight,
+                { const_cast<float *>(pixel_sizes.data()), pixel_sizes.size() }, &characters);
+    }
+
+    void set_frame_statistics_history_size(std::size_t size) const
+    {
+        cbindgen_private::slint_windowrc_set_frame_statistics_history_size(&inner, size);
+    }
+
+    SharedVector<cbindgen_private::FrameStatistics> frame_statistics_history() const
+    {
+        SharedVector<cbindgen_private::FrameStatistics> history;
+        cbindgen_private::slint_windowrc_frame_statistics_history(&inner, &history);
+        return history;
+    }
+
+    template<typename F>
+    void set_frame_statistics_callback(F callback) const
+    {
+        auto actual_cb = [](const cbindgen_private::FrameStatistics *statistics, void *data) {
+            (*reinterpret_cast<F *>(data))(*statistics);
+        };
+        cbindgen_private::slint_windowrc_set_frame_statistics_callback(
+                &inner, actual_cb, [](void *user_data) { delete reinterpret_cast<F *>(user_data); },
+                new F(std::move(callback)));
+    }
+
+    template<typename F>
+    uint64_t request_animation_frame(F callback) const
+    {
+        using Storage = ClosureStorage<F, std::chrono::milliseconds>;
+        return cbindgen_private::slint_windowrc_request_animation_frame(
+                &inner,
+                [](uint64_t tick, void *user_data) {
+                    Storage::visit(user_data, [&](auto &f) { f(std::chrono::milliseconds(tick)); });
+                },
+                Storage::drop, Storage::create(std::move(callback)));
+    }
+
+    void cancel_animation_frame(uint64_t id) const
+    {
+        cbindgen_private::slint_windowrc_cancel_animation_frame(&inner, id);
+    }
+
 private:
     cbindgen_private::WindowAdapterRcOpaque inner;
 };
@@ -382,6 +452,36 @@ public:
     }
 };
 
+/// The statistics of a frame rendered in a Window. See Window::frame_statistics_history() and
+/// Window::on_frame_rendered().
+struct FrameStatistics
+{
+    /// The wall-clock time spent rendering the scene
+    std::chrono::nanoseconds frame_time;
+    /// The time spent evaluating bindings while rendering, which includes the layouts
+    std::chrono::nanoseconds binding_time;
+    /// The number of items visited while traversing the item tree
+    uint64_t items_visited;
+    /// The number of items that were drawn, i.e. not clipped away
+    uint64_t items_drawn;
+    /// The area of the region that was redrawn, in physical pixels. Renderers that always
+    /// redraw everything report the area of the window.
+    uint64_t dirty_region_area;
+    /// The number of images that were uploaded to textures
+    uint64_t texture_uploads;
+
+    /// \private
+    static FrameStatistics from_inner(const cbindgen_private::FrameStatistics &s)
+    {
+        return { std::chrono::nanoseconds(s.frame_time_ns),
+                 std::chrono::nanoseconds(s.binding_time_ns),
+                 s.items_visited,
+                 s.items_drawn,
+                 s.dirty_region_area,
+                 s.texture_uploads };
+    }
+};
+
 /// This class represents a window towards the windowing system, that's used to render the
 /// scene of a component. It provides API to control windowing system specific aspects such
 /// as the position on the screen.
@@ -455,6 +555,70 @@ public:
     /// a window frame (if present).
     void set_size(const slint::PhysicalSize &size) { inner.set_physical_size(size); }
 
+    /// Keeps the statistics of the last \a size frames rendered in this window, to be returned by
+    /// frame_statistics_history(). Collecting the statistics has a small cost, so it is disabled
+    /// until this function is called with a non-zero size or on_frame_rendered() is called.
+    /// A size of 0 clears the history.
+    void set_frame_statistics_history_size(std::size_t size)
+    {
+        inner.set_frame_statistics_history_size(size);
+    }
+
+    /// Returns the statistics of the last rendered frames, from the oldest to the most recent.
+    std::vector<FrameStatistics> frame_statistics_history() const
+    {
+        auto history = inner.frame_statistics_history();
+        std::vector<FrameStatistics> result;
+        result.reserve(history.size());
+        std::transform(history.begin(), history.end(), std::back_inserter(result),
+                       FrameStatistics::from_inner);
+        return result;
+    }
+
+    /// Registers a callback that is invoked with the FrameStatistics of each frame after it was
+    /// rendered, for example to export them to a telemetry system.
+    template<std::invocable<const FrameStatistics &> F>
+    void on_frame_rendered(F callback)
+    {
+        inner.set_frame_statistics_callback(
+                [callback = std::move(callback)](
+                        const cbindgen_private::FrameStatistics &statistics) mutable {
+                    callback(FrameStatistics::from_inner(statistics));
+                });
+    }
+
+    /// Registers a callback that is invoked once, right before the next frame of this window is
+    /// rendered, with the time of that frame on the animation clock. The properties it sets are
+    /// shown in that same frame, so it is better suited than a Timer to drive an animation at the
+    /// rate of the display.
+    ///
+    /// To be invoked on every frame, the callback registers itself again. The window only redraws
+    /// while callbacks are registered or properties change, so a stopped animation costs nothing.
+    /// \returns an id to pass to cancel_animation_frame()
+    template<std::invocable<std::chrono::milliseconds> F>
+    uint64_t request_animation_frame(F callback)
+    {
+        return inner.request_animation_frame(std::move(callback));
+    }
+
+    /// Unregisters a callback registered with request_animation_frame(). Does nothing if it
+    /// was already invoked or cancelled.
+    void cancel_animation_frame(uint64_t id) { inner.cancel_animation_frame(id); }
+
+    /// Rasterizes the glyphs of \a characters in the font \a family (the default font if empty)
+    /// with the given \a weight (the default weight if 0), at each of the \a pixel_sizes in
+    /// logical pixels, so that the first frame showing them doesn't have to.
+    ///
+    /// Call it at startup with the characters and sizes that the first screens show, for example
+    /// a CJK character set. Renderers that shape and rasterize text on the CPU do the work right
+    /// away; those that keep their glyphs in a GPU texture do it with the next frame, which this
+    /// function requests. Renderers without a glyph cache ignore it.
+    void prewarm_glyph_cache(const SharedString &family, int weight,
+                             std::span<const float> pixel_sizes, const SharedString &characters)
+    {
+        inner.prewarm_glyph_cache(family, weight, pixel_sizes, characters);
+    }
+
     /// \private
     private_api::WindowAdapterRc &window_handle() { return inner; }
     /// \private
@@ -539,20 +703,36 @@ inline LayoutInfo LayoutInfo::merge(const LayoutInfo &other) const
 
 namespace private_api {
 
-inline SharedVector<float> solve_box_layout(const cbindgen_private::BoxLayoutData &data,
-                                            cbindgen_private::Slice<int> repeater_indexes)
+// The overloads taking a result are called by the bindings of the layout caches with the previous
+// value of the cache, whose memory is reused if it isn't shared.
+
+inline void solve_box_layout(const cbindgen_private::BoxLayoutData &data,
+                             cbindgen_private::Slice<int> repeater_indexes,
+                             SharedVector<float> &result)
 {
-    SharedVector<float> result;
     cbindgen_private::Slice<uint32_t> ri { reinterpret_cast<uint32_t *>(repeater_indexes.ptr),
                                            repeater_indexes.len };
     cbindgen_private::slint_solve_box_layout(&data, ri, &result);
+}
+
+inline SharedVector<float> solve_box_layout(const cbindgen_private::BoxLayoutData &data,
+                                            cbindgen_private::Slice<int> repeater_indexes)
+{
+    SharedVector<float> result;
+    solve_box_layout(data, repeater_indexes, result);
     return result;
 }
 
+inline void solve_grid_layout(const cbindgen_private::GridLayoutData &data,
+                              SharedVector<float> &result)
+{
+    cbindgen_private::slint_solve_grid_layout(&data, &result);
+}
+
 inline SharedVector<float> solve_grid_layout(const cbindgen_private::GridLayoutData &data)
 {
     SharedVector<float> result;
-    cbindgen_private::slint_solve_grid_layout(&data, &result);
+    solve_grid_layout(data, result);
     return result;
 }
 
@@ -578,13 +758,20 @@ box_layout_info_ortho(cbindgen_private::Slice<cbindgen_private::BoxLayoutCellDat
     return cbindgen_private::slint_box_layout_info_ortho(cells, &padding);
 }
 
-inline SharedVector<float> solve_path_layout(const cbindgen_private::PathLayoutData &data,
-                                             cbindgen_private::Slice<int> repeater_indexes)
+inline void solve_path_layout(const cbindgen_private::PathLayoutData &data,
+                              cbindgen_private::Slice<int> repeater_indexes,
+                              SharedVector<float> &result)
 {
-    SharedVector<float> result;
     cbindgen_private::Slice<uint32_t> ri { reinterpret_cast<uint32_t *>(repeater_indexes.ptr),
                                            repeater_indexes.len };
     cbindgen_private::slint_solve_path_layout(&data, ri, &result);
+}
+
+inline SharedVector<float> solve_path_layout(const cbindgen_private::PathLayoutData &data,
+                                             cbindgen_private::Slice<int> repeater_indexes)
+{
+    SharedVector<float> result;
+    solve_path_layout(data, repeater_indexes, result);
     return result;
 }
 
@@ -602,6 +789,14 @@ struct ModelChangeListener
     virtual void row_added(int index, int count) = 0;
     virtual void row_removed(int index, int count) = 0;
     virtual void row_changed(int index) = 0;
+    /// Called when `count` contiguous rows starting at `index` have changed. The default
+    /// implementation calls row_changed() for each of them.
+    virtual void rows_changed(int index, int count)
+    {
+        for (int i = index; i < index + count; ++i) {
+            row_changed(i);
+        }
+    }
     virtual void reset() = 0;
 };
 using ModelPeer = std::weak_ptr<ModelChangeListener>;
@@ -609,10 +804,14 @@ using ModelPeer = std::weak_ptr<ModelChangeListener>;
 template<typename M>
 auto access_array_index(const M &model, int index)
 {
-    if (const auto v = model->row_data_tracked(index)) {
-        return *v;
+    model->track_row_data_changes(index);
+    using ModelData = std::remove_cvref_t<decltype(*model->row_data(index))>;
+    if (const ModelData *data = model->row_data_ptr(index)) {
+        return *data;
+    } else if (auto v = model->row_data(index)) {
+        return ModelData(std::move(*v));
     } else {
-        return decltype(*v) {};
+        return ModelData {};
     }
 }
 
@@ -636,6 +835,35 @@ public:
     /// Returns the data for a particular row. This function should be called with `row <
     /// row_count()`.
     virtual std::optional<ModelData> row_data(int i) const = 0;
+    /// Returns a pointer to the data of a particular row if the model stores it, so that it can be
+    /// read without copying it, or null otherwise. The pointer is valid until the model changes.
+    ///
+    /// The default implementation returns null. Models backed by a container override it.
+    virtual const ModelData *row_data_ptr(int) const { return nullptr; }
+
+    /// Calls \a f with the data of \a row, without copying it if row_data_ptr() returns it.
+    /// \returns the result of \a f, or an empty optional if the row doesn't exist. If \a f returns
+    /// void, whether the row exists.
+    template<std::invocable<const ModelData &> F>
+    auto visit_row_data(int row, F &&f) const
+    {
+        using Result = std::invoke_result_t<F, const ModelData &>;
+        if constexpr (std::is_void_v<Result>) {
+            return visit_row_data(row, [&](const ModelData &data) {
+                       f(data);
+                       return true;
+                   })
+                    .has_value();
+        } else {
+            if (const ModelData *data = row_data_ptr(row)) {
+                return std::optional<Result>(f(*data));
+            } else if (auto data_copy = row_data(row)) {
+                return std::optional<Result>(f(*data_copy));
+            } else {
+                return std::optional<Result>();
+            }
+        }
+    }
     /// Sets the data for a particular row.
     ///
     /// This function should only be called with `row < row_count()`.
@@ -643,7 +871,7 @@ public:
     /// If the model cannot support data changes, then it is ok to do nothing.
     /// The default implementation will print a warning to stderr.
     ///
-    /// If the model can update the data, it should also call `row_changed`
+    /// If the model can update the data, it should also call `row_changed` or `rows_changed`
     virtual void set_row_data(int, const ModelData &)
     {
         std::cerr << "Model::set_row_data was called on a read-only model" << std::endl;
@@ -663,11 +891,7 @@ public:
     /// evaluating dependency and get notified when this model's row data changes.
     void track_row_data_changes(int row) const
     {
-        auto it = std::lower_bound(tracked_rows.begin(), tracked_rows.end(), row);
-        if (it == tracked_rows.end() || row < *it) {
-            tracked_rows.insert(it, row);
-        }
-        model_row_data_dirty_property.get();
+        tracked_rows.try_emplace(row).first->second.get();
     }
 
     /// \private
@@ -678,42 +902,227 @@ public:
         return row_data(row);
     }
 
+    /// Holds back the notifications of the changes to this model until the matching call to
+    /// end_update(), for example while adding many rows in a loop. Calls can be nested.
+    void begin_update() { ++update_depth; }
+    /// Ends the update started by the matching begin_update(). When it's the outermost one, the
+    /// views are notified of the changes made in between at once: consecutive additions,
+    /// removals and changes are merged into ranges. More scattered changes, or rows that moved
+    /// after they were added or changed, are notified as a reset of the model.
+    void end_update()
+    {
+        if (--update_depth > 0) {
+            return;
+        }
+        auto changes = std::exchange(pending_changes, {});
+        if (std::exchange(pending_reset, false) || !pending_changes_are_in_place(changes)) {
+            notify_reset();
+            return;
+        }
+        for (const auto &change : changes) {
+            switch (change.kind) {
+            case PendingChange::Kind::Added:
+                notify_row_added(change.index, change.count);
+                break;
+            case PendingChange::Kind::Removed:
+                notify_row_removed(change.index, change.count);
+                break;
+            case PendingChange::Kind::Changed:
+                notify_rows_changed(change.index, change.count);
+                break;
+            }
+        }
+    }
+
+    /// Calls begin_update() on a model when constructed and end_update() when destroyed.
+    class UpdateGuard
+    {
+    public:
+        /// Begins an update of \a model
+        explicit UpdateGuard(Model &m) : model(m) { model.begin_update(); }
+        ~UpdateGuard() { model.end_update(); }
+        UpdateGuard(const UpdateGuard &) = delete;
+        UpdateGuard &operator=(const UpdateGuard &) = delete;
+
+    private:
+        Model &model;
+    };
+
+    /// Returns a guard that holds back the notifications of this model until it's destroyed.
+    /// See begin_update().
+    [[nodiscard]] UpdateGuard batch_update() { return UpdateGuard(*this); }
+
 protected:
     /// Notify the views that a specific row was changed
-    void row_changed(int row)
+    void row_changed(int row) { rows_changed(row, 1); }
+    /// Notify the views that \a count contiguous rows, starting at \a index, were changed.
+    /// This is much cheaper than calling row_changed() for each of the rows.
+    void rows_changed(int index, int count)
     {
-        if (std::binary_search(tracked_rows.begin(), tracked_rows.end(), row)) {
-            model_row_data_dirty_property.mark_dirty();
+        if (count <= 0) {
+            return;
+        }
+        if (update_depth > 0) {
+            record_change(PendingChange::Kind::Changed, index, count);
+            return;
         }
-        for_each_peers([=](auto peer) { peer->row_changed(row); });
+        notify_rows_changed(index, count);
     }
     /// Notify the views that rows were added
     void row_added(int index, int count)
     {
-        model_row_count_dirty_property.mark_dirty();
-        tracked_rows.clear();
-        model_row_data_dirty_property.mark_dirty();
-        for_each_peers([=](auto peer) { peer->row_added(index, count); });
+        if (update_depth > 0) {
+            record_change(PendingChange::Kind::Added, index, count);
+            return;
+        }
+        notify_row_added(index, count);
     }
     /// Notify the views that rows were removed
     void row_removed(int index, int count)
     {
-        model_row_count_dirty_property.mark_dirty();
-        tracked_rows.clear();
-        model_row_data_dirty_property.mark_dirty();
-        for_each_peers([=](auto peer) { peer->row_removed(index, count); });
+        if (update_depth > 0) {
+            record_change(PendingChange::Kind::Removed, index, count);
+            return;
+        }
+        notify_row_removed(index, count);
     }
 
     /// Notify the views that the model has been changed and that everything needs to be reloaded
     void reset()
+    {
+        if (update_depth > 0) {
+            pending_changes.clear();
+            pending_reset = true;
+            return;
+        }
+        notify_reset();
+    }
+
+private:
+    using TrackedRows = std::map<int, private_api::Property<bool>>;
+
+    /// A notification held back by begin_update()
+    struct PendingChange
+    {
+        enum class Kind { Added, Removed, Changed };
+        Kind kind;
+        int index;
+        int count;
+    };
+    /// Beyond this number of separate changes, the update ends with a reset of the model
+    static constexpr std::size_t max_pending_changes = 64;
+
+    /// Merges the change with the previous one when they are adjacent, so that a loop of
+    /// push_back(), or of erase() at the same index, results in a single notification.
+    void record_change(PendingChange::Kind kind, int index, int count)
+    {
+        if (pending_reset || count <= 0) {
+            return;
+        }
+        if (!pending_changes.empty()) {
+            auto &last = pending_changes.back();
+            using Kind = PendingChange::Kind;
+            if (kind == Kind::Added && last.kind == Kind::Added && index >= last.index
+                && index <= last.index + last.count) {
+                last.count += count;
+                return;
+            }
+            if (kind == Kind::Removed && last.kind == Kind::Removed) {
+                if (index == last.index) {
+                    last.count += count;
+                    return;
+                } else if (index + count == last.index) {
+                    last.index = index;
+                    last.count += count;
+                    return;
+                }
+            }
+            if (kind == Kind::Changed && last.kind == Kind::Changed
+                && index <= last.index + last.count && index + count >= last.index) {
+                int end = std::max(index + count, last.index + last.count);
+                last.index = std::min(index, last.index);
+                last.count = end - last.index;
+                return;
+            }
+            // The views will get the data of the added rows anyway
+            if (kind == Kind::Changed && last.kind == Kind::Added && index >= last.index
+                && index + count <= last.index + last.count) {
+                return;
+            }
+        }
+        if (pending_changes.size() == max_pending_changes) {
+            pending_changes.clear();
+            pending_reset = true;
+            return;
+        }
+        pending_changes.push_back(PendingChange { kind, index, count });
+    }
+
+    /// The views, such as FilterModel, can read the added and changed rows when notified. That
+    /// only gives them the rows of the change when no later addition or removal moved them.
+    static bool pending_changes_are_in_place(const std::vector<PendingChange> &changes)
+    {
+        for (auto change = changes.begin(); change != changes.end(); ++change) {
+            if (change->kind == PendingChange::Kind::Removed) {
+                continue;
+            }
+            for (auto later = std::next(change); later != changes.end(); ++later) {
+                if (later->kind != PendingChange::Kind::Changed
+                    && later->index < change->index + change->count) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    void notify_rows_changed(int index, int count)
+    {
+        invalidate_tracked_rows(tracked_rows.lower_bound(index),
+                                tracked_rows.lower_bound(index + count));
+        for_each_peers([=](auto peer) { peer->rows_changed(index, count); });
+    }
+    void notify_row_added(int index, int count)
     {
         model_row_count_dirty_property.mark_dirty();
-        tracked_rows.clear();
-        model_row_data_dirty_property.mark_dirty();
+        // The data of all the rows after the insertion point has moved
+        invalidate_tracked_rows(tracked_rows.lower_bound(index), tracked_rows.end());
+        for_each_peers([=](auto peer) { peer->row_added(index, count); });
+    }
+    void notify_row_removed(int index, int count)
+    {
+        model_row_count_dirty_property.mark_dirty();
+        // The data of all the rows after the removal point has moved
+        invalidate_tracked_rows(tracked_rows.lower_bound(index), tracked_rows.end());
+        for_each_peers([=](auto peer) { peer->row_removed(index, count); });
+    }
+    void notify_reset()
+    {
+        model_row_count_dirty_property.mark_dirty();
+        invalidate_tracked_rows(tracked_rows.begin(), tracked_rows.end());
         for_each_peers([=](auto peer) { peer->reset(); });
     }
 
-private:
+    /// Notifies the bindings that depend on the rows in the range [begin, end) and forgets
+    /// about them. The rows will be tracked again when the bindings get re-evaluated.
+    void invalidate_tracked_rows(typename TrackedRows::iterator begin,
+                                 typename TrackedRows::iterator end)
+    {
+        if (begin == end) {
+            return;
+        }
+        // Move the rows out first, as marking them dirty could track rows again
+        TrackedRows invalidated;
+        while (begin != end) {
+            auto next = std::next(begin);
+            invalidated.insert(tracked_rows.extract(begin));
+            begin = next;
+        }
+        for (const auto &[row, property] : invalidated) {
+            property.mark_dirty();
+        }
+    }
+
     template<typename F>
     void for_each_peers(const F &f)
     {
@@ -730,8 +1139,12 @@ private:
     }
     std::vector<private_api::ModelPeer> peers;
     private_api::Property<bool> model_row_count_dirty_property;
-    private_api::Property<bool> model_row_data_dirty_property;
-    mutable std::vector<int> tracked_rows;
+    /// One property per row that is used by a binding, so that changing a row only
+    /// re-evaluates the bindings that depend on it.
+    mutable TrackedRows tracked_rows;
+    int update_depth = 0;
+    bool pending_reset = false;
+    std::vector<PendingChange> pending_changes;
 };
 
 namespace private_api {
@@ -755,6 +1168,10 @@ public:
             return {};
         return data[i];
     }
+    const ModelData *row_data_ptr(int i) const override
+    {
+        return i < row_count() ? &data[i] : nullptr;
+    }
     void set_row_data(int i, const ModelData &value) override
     {
         if (i < row_count()) {
@@ -764,6 +1181,69 @@ public:
     }
 };
 
+/// An operation of the edit script returned by edit_script()
+enum class EditOperation { Keep, Remove, Insert };
+
+/// Returns the shortest edit script that transforms a sequence of \a old_size elements into one
+/// of \a new_size elements, with Myers' algorithm, or nothing if it needs more than \a max_edits
+/// insertions and removals. `same(i, j)` returns whether the element \a i of the old sequence is
+/// the element \a j of the new one. Runs in O((old_size + new_size) * edits).
+template<typename Same>
+std::optional<std::vector<EditOperation>> edit_script(int old_size, int new_size, int max_edits,
+                                                      const Same &same)
+{
+    max_edits = std::min(max_edits, old_size + new_size);
+    // v[offset + k] is the furthest x reached on the diagonal k = x - y
+    const int offset = max_edits + 1;
+    std::vector<int> v(2 * max_edits + 3, 0);
+    // The state of v before each number of edits, to backtrack
+    std::vector<std::vector<int>> trace;
+    for (int d = 0; d <= max_edits; ++d) {
+        trace.push_back(v);
+        for (int k = -d; k <= d; k += 2) {
+            int x = (k == -d || (k != d && v[offset + k - 1] < v[offset + k + 1]))
+                    ? v[offset + k + 1]
+                    : v[offset + k - 1] + 1;
+            int y = x - k;
+            while (x < old_size && y < new_size && same(x, y)) {
+                ++x;
+                ++y;
+            }
+            v[offset + k] = x;
+            if (x < old_size || y < new_size) {
+                continue;
+            }
+            std::vector<EditOperation> script;
+            for (; d >= 0; --d) {
+                const auto &previous = trace[d];
+                int diagonal = x - y;
+                int previous_k = (diagonal == -d
+                                  || (diagonal != d
+                                      && previous[offset + diagonal - 1]
+                                              < previous[offset + diagonal + 1]))
+                        ? diagonal + 1
+                        : diagonal - 1;
+                int previous_x = previous[offset + previous_k];
+                int previous_y = previous_x - previous_k;
+                while (x > previous_x && y > previous_y) {
+                    script.push_back(EditOperation::Keep);
+                    --x;
+                    --y;
+                }
+                if (d > 0) {
+                    script.push_back(x == previous_x ? EditOperation::Insert
+                                                     : EditOperation::Remove);
+                }
+                x = previous_x;
+                y = previous_y;
+            }
+            std::reverse(script.begin(), script.end());
+            return script;
+        }
+    }
+    return {};
+}
+
 /// Model to be used when we just want to repeat without data.
 struct IntModel : Model<int>
 {
@@ -800,6 +1280,10 @@ public:
             return {};
         return std::optional<ModelData> { data[i] };
     }
+    const ModelData *row_data_ptr(int i) const override
+    {
+        return i < row_count() ? &data[i] : nullptr;
+    }
     void set_row_data(int i, const ModelData &value) override
     {
         if (i < row_count()) {
@@ -815,6 +1299,20 @@ public:
         this->row_added(int(data.size()) - 1, 1);
     }
 
+    /// Append a new row, moving the given value into the model
+    void push_back(ModelData &&value)
+    {
+        data.push_back(std::move(value));
+        this->row_added(int(data.size()) - 1, 1);
+    }
+
+    /// Appends the values of the range [\a first, \a last) as new rows
+    template<std::input_iterator It>
+    void append(It first, It last)
+    {
+        insert(data.size(), first, last);
+    }
+
     /// Remove the row at the given index from the model
     void erase(int index)
     {
@@ -822,12 +1320,143 @@ public:
         this->row_removed(index, 1);
     }
 
+    /// Removes the \a count rows starting at \a index from the model
+    void erase(int index, int count)
+    {
+        if (count <= 0) {
+            return;
+        }
+        data.erase(data.begin() + index, data.begin() + index + count);
+        this->row_removed(index, count);
+    }
+
     /// Inserts the given value as a new row at the specified index
     void insert(size_t index, const ModelData &value)
     {
         data.insert(data.begin() + index, value);
         this->row_added(int(index), 1);
     }
+
+    /// Inserts the given value as a new row at the specified index, moving it into the model
+    void insert(size_t index, ModelData &&value)
+    {
+        data.insert(data.begin() + index, std::move(value));
+        this->row_added(int(index), 1);
+    }
+
+    /// Inserts the values of the range [\a first, \a last) as new rows at the specified index
+    template<std::input_iterator It>
+    void insert(size_t index, It first, It last)
+    {
+        auto old_size = data.size();
+        data.insert(data.begin() + index, first, last);
+        if (data.size() > old_size) {
+            this->row_added(int(index), int(data.size() - old_size));
+        }
+    }
+
+    /// Reserves the memory for \a capacity rows, to add them without reallocation
+    void reserve(size_t capacity) { data.reserve(capacity); }
+
+    /// Replaces the rows of the model with \a new_data, comparing the rows with `operator==`.
+    /// The views are only notified of the rows that were removed or inserted, so that a
+    /// Repeater keeps the instances of the other rows.
+    void set_vector(std::vector<ModelData> new_data)
+    {
+        set_vector(std::move(new_data),
+                   [](const ModelData &row) -> const ModelData & { return row; });
+    }
+
+    /// Replaces the rows of the model with \a new_data, where the rows for which \a key returns
+    /// equal values are the same row, for example the rows with the same database id. The views
+    /// are notified of the rows that were removed or inserted, and of the rows that were kept but
+    /// whose data changed. Without `operator==` for ModelData, all the kept rows are notified
+    /// as changed.
+    ///
+    /// The rows are compared with Myers' diff algorithm, after skipping the rows that are the
+    /// same at the start and at the end. When more than a few hundred rows were inserted or
+    /// removed in between, the model is reset instead.
+    template<typename KeyFn>
+    void set_vector(std::vector<ModelData> new_data, const KeyFn &key)
+    {
+        constexpr int max_edits = 256;
+        auto same = [&](const ModelData &a, const ModelData &b) { return key(a) == key(b); };
+        size_t prefix = 0;
+        while (prefix < data.size() && prefix < new_data.size()
+               && same(data[prefix], new_data[prefix])) {
+            ++prefix;
+        }
+        size_t suffix = 0;
+        while (suffix < data.size() - prefix && suffix < new_data.size() - prefix
+               && same(data[data.size() - suffix - 1], new_data[new_data.size() - suffix - 1])) {
+            ++suffix;
+        }
+        auto script = private_api::edit_script(
+                int(data.size() - prefix - suffix), int(new_data.size() - prefix - suffix),
+                max_edits,
+                [&](int i, int j) { return same(data[prefix + i], new_data[prefix + j]); });
+        if (!script) {
+            data = std::move(new_data);
+            this->reset();
+            return;
+        }
+
+        // The rows kept at the start and at the end may have changed too
+        using private_api::EditOperation;
+        std::vector<EditOperation> operations(prefix, EditOperation::Keep);
+        operations.insert(operations.end(), script->begin(), script->end());
+        operations.insert(operations.end(), suffix, EditOperation::Keep);
+
+        // Apply the operations one run at a time, so that the views read the data of the rows
+        // they are notified about.
+        size_t row = 0;
+        size_t new_row = 0;
+        for (size_t i = 0; i < operations.size();) {
+            size_t run = 1;
+            while (i + run < operations.size() && operations[i + run] == operations[i]) {
+                ++run;
+            }
+            switch (operations[i]) {
+            case EditOperation::Keep:
+                for (size_t end = row + run; row < end;) {
+                    size_t changed = 0;
+                    while (row + changed < end
+                           && !rows_equal(data[row + changed], new_data[new_row + changed])) {
+                        data[row + changed] = std::move(new_data[new_row + changed]);
+                        ++changed;
+                    }
+                    this->rows_changed(int(row), int(changed));
+                    row += changed;
+                    new_row += changed;
+                    if (row < end) {
+                        ++row;
+                        ++new_row;
+                    }
+                }
+                break;
+            case EditOperation::Remove:
+                erase(int(row), int(run));
+                break;
+            case EditOperation::Insert:
+                insert(row, std::make_move_iterator(new_data.begin() + new_row),
+                       std::make_move_iterator(new_data.begin() + new_row + run));
+                row += run;
+                new_row += run;
+                break;
+            }
+            i += run;
+        }
+    }
+
+private:
+    static bool rows_equal(const ModelData &a, const ModelData &b)
+    {
+        if constexpr (std::equality_comparable<ModelData>) {
+            return a == b;
+        } else {
+            return false;
+        }
+    }
 };
 
 template<typename ModelData>
@@ -853,10 +1482,8 @@ struct FilterModelInner : private_api::ModelChangeListener
 
         std::vector<int> added_accepted_rows;
         for (int i = index; i < index + count; ++i) {
-            if (auto data = source_model->row_data(i)) {
-                if (filter_fn(*data)) {
-                    added_accepted_rows.push_back(i);
-                }
+            if (source_model->visit_row_data(i, filter_fn).value_or(false)) {
+                added_accepted_rows.push_back(i);
             }
         }
 
@@ -875,22 +1502,46 @@ struct FilterModelInner : private_api::ModelChangeListener
 
         target_model.row_added(insertion_point - accepted_rows.begin(), added_accepted_rows.size());
     }
-    void row_changed(int index) override
+    void row_changed(int index) override { rows_changed(index, 1); }
+    void rows_changed(int index, int count) override
     {
+        // Consecutive rows that stay accepted are reported as a single range
+        int changed_start = 0;
+        int changed_count = 0;
+        auto flush_changed = [&] {
+            if (changed_count > 0) {
+                target_model.rows_changed(changed_start, changed_count);
+                changed_count = 0;
+            }
+        };
+
         auto existing_row = std::lower_bound(accepted_rows.begin(), accepted_rows.end(), index);
-        auto existing_row_index = std::distance(accepted_rows.begin(), existing_row);
-        bool is_contained = existing_row != accepted_rows.end() && *existing_row == index;
-        auto accepted_updated_row = filter_fn(*source_model->row_data(index));
+        for (int row = index; row < index + count; ++row) {
+            auto accepted = source_model->visit_row_data(row, filter_fn);
+            if (!accepted) {
+                break;
+            }
+            int existing_row_index = int(std::distance(accepted_rows.begin(), existing_row));
+            bool is_contained = existing_row != accepted_rows.end() && *existing_row == row;
+            auto accepted_updated_row = *accepted;
 
-        if (is_contained && accepted_updated_row) {
-            target_model.row_changed(existing_row_index);
-        } else if (!is_contained && accepted_updated_row) {
-            accepted_rows.insert(existing_row, index);
-            target_model.row_added(existing_row_index, 1);
-        } else if (is_contained && !accepted_updated_row) {
-            accepted_rows.erase(existing_row);
-            target_model.row_removed(existing_row_index, 1);
+            if (is_contained && accepted_updated_row) {
+                if (changed_count == 0) {
+                    changed_start = existing_row_index;
+                }
+                ++changed_count;
+                ++existing_row;
+            } else if (!is_contained && accepted_updated_row) {
+                flush_changed();
+                existing_row = accepted_rows.insert(existing_row, row) + 1;
+                target_model.row_added(existing_row_index, 1);
+            } else if (is_contained && !accepted_updated_row) {
+                flush_changed();
+                existing_row = accepted_rows.erase(existing_row);
+                target_model.row_removed(existing_row_index, 1);
+            }
         }
+        flush_changed();
     }
     void row_removed(int index, int count) override
     {
@@ -920,22 +1571,135 @@ struct FilterModelInner : private_api::ModelChangeListener
         target_model.reset();
     }
 
-    void update_mapping()
+    void update_mapping() { accepted_rows = filter_rows(); }
+
+    /// Applies the filter function again and notifies the views only about the rows that were
+    /// added or removed.
+    void refilter()
+    {
+        std::vector<int> new_rows = filter_rows();
+
+        // While notifying, the rows exposed by the model are the first `refiltered_count` rows
+        // of `new_rows` followed by the rows of `accepted_rows` starting at `remaining_start`.
+        refiltered_rows = &new_rows;
+        refiltered_count = 0;
+        remaining_start = 0;
+        auto new_len = int(new_rows.size());
+        auto old_len = int(accepted_rows.size());
+        while (refiltered_count < new_len || remaining_start < old_len) {
+            if (refiltered_count < new_len && remaining_start < old_len
+                && new_rows[refiltered_count] == accepted_rows[remaining_start]) {
+                ++refiltered_count;
+                ++remaining_start;
+                continue;
+            }
+            int removed = 0;
+            while (remaining_start + removed < old_len
+                   && (refiltered_count == new_len
+                       || accepted_rows[remaining_start + removed]
+                               < new_rows[refiltered_count])) {
+                ++removed;
+            }
+            if (removed > 0) {
+                remaining_start += removed;
+                target_model.row_removed(refiltered_count, removed);
+            }
+            int added = 0;
+            while (refiltered_count + added < new_len
+                   && (remaining_start == old_len
+                       || new_rows[refiltered_count + added] < accepted_rows[remaining_start])) {
+                ++added;
+            }
+            if (added > 0) {
+                refiltered_count += added;
+                target_model.row_added(refiltered_count - added, added);
+            }
+        }
+        refiltered_rows = nullptr;
+        accepted_rows = std::move(new_rows);
+    }
+
+    /// Returns the rows of the source model accepted by the filter function, using multiple
+    /// threads if configured so and enough rows are in the source model.
+    std::vector<int> filter_rows() const
     {
-        accepted_rows.clear();
-        for (int i = 0, count = source_model->row_count(); i < count; ++i) {
-            if (auto data = source_model->row_data(i)) {
-                if (filter_fn(*data)) {
-                    accepted_rows.push_back(i);
+        int count = source_model->row_count();
+        auto filter_range = [this](int begin, int end, std::vector<int> &result) {
+            for (int i = begin; i < end; ++i) {
+                if (source_model->visit_row_data(i, filter_fn).value_or(false)) {
+                    result.push_back(i);
                 }
             }
+        };
+
+        int chunks = std::min(int(thread_count), count / parallel_chunk_size);
+        if (chunks <= 1) {
+            std::vector<int> result;
+            filter_range(0, count, result);
+            return result;
+        }
+
+        std::vector<std::vector<int>> chunk_results(chunks);
+        auto chunk_begin = [&](int chunk) { return int(int64_t(count) * chunk / chunks); };
+        {
+            // The destructor of a future returned by std::async waits for its thread, so that
+            // the other chunks are done before an exception of the filter function propagates.
+            std::vector<std::future<void>> workers;
+            workers.reserve(chunks - 1);
+            for (int chunk = 1; chunk < chunks; ++chunk) {
+                workers.push_back(std::async(std::launch::async, filter_range, chunk_begin(chunk),
+                                             chunk_begin(chunk + 1),
+                                             std::ref(chunk_results[chunk])));
+            }
+            filter_range(0, chunk_begin(1), chunk_results[0]);
+            for (auto &worker : workers) {
+                worker.get(); // rethrows the exception of the filter function, if any
+            }
+        }
+
+        std::size_t total = 0;
+        for (const auto &chunk_result : chunk_results) {
+            total += chunk_result.size();
+        }
+        std::vector<int> result;
+        result.reserve(total);
+        for (const auto &chunk_result : chunk_results) {
+            result.insert(result.end(), chunk_result.begin(), chunk_result.end());
+        }
+        return result;
+    }
+
+    int mapped_row_count() const
+    {
+        if (refiltered_rows) {
+            return refiltered_count + int(accepted_rows.size()) - remaining_start;
+        }
+        return int(accepted_rows.size());
+    }
+
+    /// Returns the row in the source model for a row of the FilterModel
+    int mapped_row(int row) const
+    {
+        if (refiltered_rows) {
+            return row < refiltered_count ? (*refiltered_rows)[row]
+                                          : accepted_rows[row - refiltered_count + remaining_start];
         }
+        return accepted_rows[row];
     }
 
+    /// The minimum amount of source rows each thread filters
+    static constexpr int parallel_chunk_size = 4096;
+
     std::shared_ptr<slint::Model<ModelData>> source_model;
     std::function<bool(const ModelData &)> filter_fn;
     std::vector<int> accepted_rows;
     slint::FilterModel<ModelData> &target_model;
+    unsigned int thread_count = 1;
+
+    /// State of the mapping while refilter() notifies the views
+    const std::vector<int> *refiltered_rows = nullptr;
+    int refiltered_count = 0;
+    int remaining_start = 0;
 };
 }
 
@@ -959,27 +1723,51 @@ public:
         inner->source_model->attach_peer(inner);
     }
 
-    int row_count() const override { return inner->accepted_rows.size(); }
+    int row_count() const override { return inner->mapped_row_count(); }
 
     std::optional<ModelData> row_data(int i) const override
     {
-        if (i < 0 || size_t(i) >= inner->accepted_rows.size())
+        if (i < 0 || i >= inner->mapped_row_count())
             return {};
-        return inner->source_model->row_data(inner->accepted_rows[i]);
+        return inner->source_model->row_data(inner->mapped_row(i));
+    }
+
+    const ModelData *row_data_ptr(int i) const override
+    {
+        if (i < 0 || i >= inner->mapped_row_count())
+            return nullptr;
+        return inner->source_model->row_data_ptr(inner->mapped_row(i));
     }
 
     void set_row_data(int i, const ModelData &value) override
     {
-        inner->source_model->set_row_data(inner->accepted_rows[i], value);
+        inner->source_model->set_row_data(inner->mapped_row(i), value);
     }
 
     /// Re-applies the model's filter function on each row of the source model. Use this if state
     /// external to the filter function has changed.
-    void reset() { inner->reset(); }
+    ///
+    /// Only the rows that are newly accepted or rejected by the filter are notified as added or
+    /// removed, so the views keep the rows that are still visible.
+    void reset() { inner->refilter(); }
+
+    /// Sets the number of threads that are used to apply the filter function on all the rows of
+    /// a large source model, when calling reset(). With the default of 1, the filter function
+    /// is only called from the current thread. Passing 0 uses one thread per hardware thread.
+    ///
+    /// When using more than one thread, both the filter function and the row_data() function
+    /// of the source model must be safe to call from multiple threads at the same time.
+    void set_filter_thread_count(unsigned int count)
+    {
+        if (count == 0) {
+            count = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+        inner->thread_count = count;
+    }
 
     /// Given the \a filtered_row index, this function returns the corresponding row index in the
     /// source model.
-    int unfiltered_row(int filtered_row) const { return inner->accepted_rows[filtered_row]; }
+    int unfiltered_row(int filtered_row) const { return inner->mapped_row(filtered_row); }
 
     /// Returns the source model of this filter model.
     std::shared_ptr<Model<ModelData>> source_model() const { return inner->source_model; }
@@ -1000,12 +1788,97 @@ struct MapModelInner : private_api::ModelChangeListener
     {
     }
 
-    void row_added(int index, int count) override { target_model.row_added(index, count); }
-    void row_changed(int index) override { target_model.row_changed(index); }
-    void row_removed(int index, int count) override { target_model.row_removed(index, count); }
-    void reset() override { target_model.reset(); }
+    void row_added(int index, int count) override
+    {
+        // Shift the cached rows, starting with the last one so that the keys do not collide
+        for (auto it = cache_index.end(); it != cache_index.begin();) {
+            --it;
+            if (it->first < index) {
+                break;
+            }
+            it = shift_cached_row(it, count);
+        }
+        target_model.row_added(index, count);
+    }
+    void row_changed(int index) override { rows_changed(index, 1); }
+    void rows_changed(int index, int count) override
+    {
+        erase_cached_rows(index, index + count);
+        target_model.rows_changed(index, count);
+    }
+    void row_removed(int index, int count) override
+    {
+        erase_cached_rows(index, index + count);
+        for (auto it = cache_index.lower_bound(index + count); it != cache_index.end();) {
+            it = std::next(shift_cached_row(it, -count));
+        }
+        target_model.row_removed(index, count);
+    }
+    void reset() override
+    {
+        cache.clear();
+        cache_index.clear();
+        target_model.reset();
+    }
+
+    using Cache = std::list<std::pair<int, MappedModelData>>;
+
+    /// Returns the cached mapped value of the row, and marks it as recently used
+    const MappedModelData *cached_row(int row)
+    {
+        auto it = cache_index.find(row);
+        if (it == cache_index.end()) {
+            return nullptr;
+        }
+        cache.splice(cache.begin(), cache, it->second);
+        return &it->second->second;
+    }
+
+    /// Moves the mapped value of the row into the cache, which must be enabled, and returns it
+    const MappedModelData &insert_cached_row(int row, MappedModelData &&value)
+    {
+        cache.emplace_front(row, std::move(value));
+        cache_index[row] = cache.begin();
+        trim_cache();
+        return cache.front().second;
+    }
+
+    /// Evicts the least recently used rows until the cache fits in its capacity
+    void trim_cache()
+    {
+        while (cache.size() > cache_capacity) {
+            cache_index.erase(cache.back().first);
+            cache.pop_back();
+        }
+    }
+
+    void erase_cached_rows(int begin, int end)
+    {
+        auto it = cache_index.lower_bound(begin);
+        while (it != cache_index.end() && it->first < end) {
+            cache.erase(it->second);
+            it = cache_index.erase(it);
+        }
+    }
+
+    /// Moves the cached row by `delta` rows. The target row must not be in the cache.
+    /// Returns the iterator to the moved entry.
+    typename std::map<int, typename Cache::iterator>::iterator
+    shift_cached_row(typename std::map<int, typename Cache::iterator>::iterator it, int delta)
+    {
+        auto node = cache_index.extract(it);
+        node.key() += delta;
+        node.mapped()->first = node.key();
+        return cache_index.insert(std::move(node)).position;
+    }
 
     slint::MapModel<SourceModelData, MappedModelData> &target_model;
+
+    /// The cached mapped values, the most recently used first
+    Cache cache;
+    /// Maps a row to its entry in the cache
+    std::map<int, typename Cache::iterator> cache_index;
+    std::size_t cache_capacity = 0;
 };
 }
 
@@ -1040,10 +1913,23 @@ public:
 
     std::optional<MappedModelData> row_data(int i) const override
     {
-        if (auto source_data = model->row_data(i))
-            return map_fn(*source_data);
-        else
-            return {};
+        if (auto cached = inner->cached_row(i))
+            return *cached;
+        auto mapped = model->visit_row_data(i, map_fn);
+        if (mapped && inner->cache_capacity > 0) {
+            return inner->insert_cached_row(i, std::move(*mapped));
+        }
+        return mapped;
+    }
+
+    /// Enables caching of the mapped values, for mapping functions that are expensive to call.
+    /// At most \a capacity rows are kept, the least recently used ones are evicted first. The
+    /// cached rows are invalidated when the source model notifies that they changed.
+    /// A capacity of 0, the default, disables the cache.
+    void set_cache_capacity(std::size_t capacity)
+    {
+        inner->cache_capacity = capacity;
+        inner->trim_cache();
     }
 
     /// Returns the source model of this filter model.
@@ -1088,8 +1974,7 @@ struct SortModelInner : private_api::ModelChangeListener
             auto insertion_point =
                     std::lower_bound(sorted_rows.begin(), sorted_rows.end(), inserted_value,
                                      [this](int sorted_row, const ModelData &inserted_value) {
-                                         auto sorted_elem = source_model->row_data(sorted_row);
-                                         return comp(*sorted_elem, inserted_value);
+                                         return row_less_than(sorted_row, inserted_value);
                                      });
 
             insertion_point = sorted_rows.insert(insertion_point, row);
@@ -1111,8 +1996,7 @@ struct SortModelInner : private_api::ModelChangeListener
         auto insertion_point =
                 std::lower_bound(sorted_rows.begin(), sorted_rows.end(), changed_value,
                                  [this](int sorted_row, const ModelData &changed_value) {
-                                     auto sorted_elem = source_model->row_data(sorted_row);
-                                     return comp(*sorted_elem, changed_value);
+                                     return row_less_than(sorted_row, changed_value);
                                  });
 
         insertion_point = sorted_rows.insert(insertion_point, changed_row);
@@ -1125,6 +2009,18 @@ struct SortModelInner : private_api::ModelChangeListener
             target_model.row_added(inserted_row, 1);
         }
     }
+    void rows_changed(int first_changed_row, int count) override
+    {
+        if (sorted_rows_dirty) {
+            reset();
+            return;
+        }
+        // Each changed row may end up anywhere in the sorted order, so it has to be re-inserted
+        // individually.
+        for (int row = first_changed_row; row < first_changed_row + count; ++row) {
+            row_changed(row);
+        }
+    }
     void row_removed(int first_removed_row, int count) override
     {
         if (sorted_rows_dirty) {
@@ -1169,14 +2065,23 @@ struct SortModelInner : private_api::ModelChangeListener
             sorted_rows[i] = i;
 
         std::sort(sorted_rows.begin(), sorted_rows.end(), [this](int lhs_index, int rhs_index) {
-            auto lhs_elem = source_model->row_data(lhs_index);
-            auto rhs_elem = source_model->row_data(rhs_index);
-            return comp(*lhs_elem, *rhs_elem);
+            return *source_model->visit_row_data(lhs_index, [&](const ModelData &lhs) {
+                return *source_model->visit_row_data(
+                        rhs_index, [&](const ModelData &rhs) { return comp(lhs, rhs); });
+            });
         });
 
         sorted_rows_dirty = false;
     }
 
+    /// Compares the row of the source model with \a value, without copying the row when the
+    /// source model stores it
+    bool row_less_than(int row, const ModelData &value) const
+    {
+        return *source_model->visit_row_data(
+                row, [&](const ModelData &row_data) { return comp(row_data, value); });
+    }
+
     std::shared_ptr<slint::Model<ModelData>> source_model;
     std::function<bool(const ModelData &, const ModelData &)> comp;
     slint::SortModel<ModelData> &target_model;
@@ -1212,6 +2117,14 @@ public:
         return inner->source_model->row_data(inner->sorted_rows[i]);
     }
 
+    const ModelData *row_data_ptr(int i) const override
+    {
+        inner->ensure_sorted();
+        if (i < 0 || size_t(i) >= inner->sorted_rows.size())
+            return nullptr;
+        return inner->source_model->row_data_ptr(inner->sorted_rows[i]);
+    }
+
     void set_row_data(int i, const ModelData &value) override
     {
         inner->source_model->set_row_data(inner->sorted_rows[i], value);
@@ -1235,6 +2148,283 @@ private:
     std::shared_ptr<private_api::SortModelInner<ModelData>> inner;
 };
 
+template<typename ModelData, typename Key>
+class SortByKeyModel;
+
+namespace private_api {
+template<typename ModelData, typename Key>
+struct SortByKeyModelInner : private_api::ModelChangeListener
+{
+    SortByKeyModelInner(std::shared_ptr<slint::Model<ModelData>> source_model,
+                        std::function<Key(const ModelData &)> key_fn,
+                        slint::SortByKeyModel<ModelData, Key> &target_model)
+        : source_model(source_model), key_fn(key_fn), target_model(target_model)
+    {
+    }
+
+    /// Rows are ordered by their key, and rows with the same key by their source index, so that
+    /// the position of any row can be found with a binary search.
+    bool less(const Key &lhs_key, int lhs_row, const Key &rhs_key, int rhs_row) const
+    {
+        if (lhs_key < rhs_key)
+            return true;
+        if (rhs_key < lhs_key)
+            return false;
+        return lhs_row < rhs_row;
+    }
+
+    /// Returns the position in sorted_rows where the source row with the given key is, or
+    /// would be inserted.
+    int sorted_position(const Key &key, int row) const
+    {
+        auto it = std::lower_bound(sorted_rows.begin(), sorted_rows.end(), row,
+                                   [&](int sorted_row, int row) {
+                                       return less(keys[sorted_row], sorted_row, key, row);
+                                   });
+        return int(std::distance(sorted_rows.begin(), it));
+    }
+
+    Key extract_key(int row) const { return *source_model->visit_row_data(row, key_fn); }
+
+    void row_added(int first_inserted_row, int count) override
+    {
+        if (sorted_rows_dirty) {
+            reset();
+            return;
+        }
+
+        // Adjust the existing sorted row indices to match the updated source model. This keeps
+        // their relative order, also for rows with the same key.
+        for (auto &row : sorted_rows) {
+            if (row >= first_inserted_row)
+                row += count;
+        }
+        keys.insert(keys.begin() + first_inserted_row, count, Key {});
+
+        // Rows inserted next to each other in the sorted order are notified as a single range
+        int added_start = 0;
+        int added_count = 0;
+        for (int row = first_inserted_row; row < first_inserted_row + count; ++row) {
+            keys[row] = extract_key(row);
+            int position = sorted_position(keys[row], row);
+            if (added_count > 0 && position != added_start + added_count) {
+                target_model.row_added(added_start, added_count);
+                added_count = 0;
+            }
+            if (added_count == 0) {
+                added_start = position;
+            }
+            ++added_count;
+            sorted_rows.insert(sorted_rows.begin() + position, row);
+        }
+        if (added_count > 0) {
+            target_model.row_added(added_start, added_count);
+        }
+    }
+    void row_changed(int changed_row) override { rows_changed(changed_row, 1); }
+    void rows_changed(int first_changed_row, int count) override
+    {
+        if (sorted_rows_dirty) {
+            reset();
+            return;
+        }
+
+        // Rows that keep their position are notified as ranges
+        int changed_start = 0;
+        int changed_count = 0;
+        auto flush_changed = [&] {
+            if (changed_count > 0) {
+                target_model.rows_changed(changed_start, changed_count);
+                changed_count = 0;
+            }
+        };
+
+        for (int row = first_changed_row; row < first_changed_row + count; ++row) {
+            int old_position = sorted_position(keys[row], row);
+            Key new_key = extract_key(row);
+
+            bool keeps_position = (old_position == 0
+                                   || less(keys[sorted_rows[old_position - 1]],
+                                           sorted_rows[old_position - 1], new_key, row))
+                    && (old_position + 1 == int(sorted_rows.size())
+                        || less(new_key, row, keys[sorted_rows[old_position + 1]],
+                                sorted_rows[old_position + 1]));
+            keys[row] = std::move(new_key);
+
+            if (keeps_position) {
+                if (changed_count > 0 && old_position != changed_start + changed_count) {
+                    flush_changed();
+                }
+                if (changed_count == 0) {
+                    changed_start = old_position;
+                }
+                ++changed_count;
+                continue;
+            }
+
+            flush_changed();
+            sorted_rows.erase(sorted_rows.begin() + old_position);
+            target_model.row_removed(old_position, 1);
+            int new_position = sorted_position(keys[row], row);
+            sorted_rows.insert(sorted_rows.begin() + new_position, row);
+            target_model.row_added(new_position, 1);
+        }
+        flush_changed();
+    }
+    void row_removed(int first_removed_row, int count) override
+    {
+        if (sorted_rows_dirty) {
+            reset();
+            return;
+        }
+
+        // Compact sorted_rows in a single pass, remembering the removed ranges
+        std::vector<std::pair<int, int>> removed_ranges;
+        int last_removed_position = -2;
+        auto out = sorted_rows.begin();
+        for (auto it = sorted_rows.begin(); it != sorted_rows.end(); ++it) {
+            int row = *it;
+            if (row >= first_removed_row && row < first_removed_row + count) {
+                int position = int(std::distance(sorted_rows.begin(), it));
+                if (position == last_removed_position + 1) {
+                    ++removed_ranges.back().second;
+                } else {
+                    removed_ranges.emplace_back(position, 1);
+                }
+                last_removed_position = position;
+                continue;
+            }
+            *out++ = row >= first_removed_row + count ? row - count : row;
+        }
+        sorted_rows.erase(out, sorted_rows.end());
+        keys.erase(keys.begin() + first_removed_row, keys.begin() + first_removed_row + count);
+
+        // Notify from the back, so that the positions of the other ranges stay valid
+        for (auto it = removed_ranges.rbegin(); it != removed_ranges.rend(); ++it) {
+            target_model.row_removed(it->first, it->second);
+        }
+    }
+    void reset() override
+    {
+        sorted_rows_dirty = true;
+        target_model.reset();
+    }
+
+    void ensure_sorted()
+    {
+        if (!sorted_rows_dirty) {
+            return;
+        }
+
+        int count = source_model->row_count();
+        keys.clear();
+        keys.reserve(count);
+        sorted_rows.resize(count);
+        for (int i = 0; i < count; ++i) {
+            keys.push_back(extract_key(i));
+            sorted_rows[i] = i;
+        }
+
+        std::sort(sorted_rows.begin(), sorted_rows.end(), [this](int lhs_row, int rhs_row) {
+            return less(keys[lhs_row], lhs_row, keys[rhs_row], rhs_row);
+        });
+
+        sorted_rows_dirty = false;
+    }
+
+    std::shared_ptr<slint::Model<ModelData>> source_model;
+    std::function<Key(const ModelData &)> key_fn;
+    slint::SortByKeyModel<ModelData, Key> &target_model;
+    /// The sorted order, as indices into the source model
+    std::vector<int> sorted_rows;
+    /// The cached key of each row of the source model
+    std::vector<Key> keys;
+    bool sorted_rows_dirty = true;
+};
+}
+
+/// The SortByKeyModel acts as an adapter model for a given source model by sorting all rows
+/// in the ascending order of a key. The key is extracted once from each row with the given key
+/// function and then cached, so sorting does not need to fetch and compare the source rows
+/// again and again. Rows with equal keys keep the order of the source model. The Key type must
+/// be default constructible and comparable with `operator<`.
+///
+/// Use this instead of SortModel when comparing rows is expensive, for example when copying
+/// them would copy strings, or when individual rows are changed often.
+template<typename ModelData, typename Key>
+class SortByKeyModel : public Model<ModelData>
+{
+    friend struct private_api::SortByKeyModelInner<ModelData, Key>;
+
+public:
+    /// Constructs a new SortByKeyModel that provides a sorted view on the \a source_model by
+    /// ordering the rows by the key returned by \a key_fn.
+    SortByKeyModel(std::shared_ptr<Model<ModelData>> source_model,
+                   std::function<Key(const ModelData &)> key_fn)
+        : inner(std::make_shared<private_api::SortByKeyModelInner<ModelData, Key>>(
+                std::move(source_model), std::move(key_fn), *this))
+    {
+        inner->source_model->attach_peer(inner);
+    }
+
+    int row_count() const override { return inner->source_model->row_count(); }
+
+    std::optional<ModelData> row_data(int i) const override
+    {
+        inner->ensure_sorted();
+        return inner->source_model->row_data(inner->sorted_rows[i]);
+    }
+
+    const ModelData *row_data_ptr(int i) const override
+    {
+        inner->ensure_sorted();
+        if (i < 0 || size_t(i) >= inner->sorted_rows.size())
+            return nullptr;
+        return inner->source_model->row_data_ptr(inner->sorted_rows[i]);
+    }
+
+    void set_row_data(int i, const ModelData &value) override
+    {
+        inner->ensure_sorted();
+        inner->source_model->set_row_data(inner->sorted_rows[i], value);
+    }
+    /// Extracts the keys of all rows and sorts them again. Use this if state external to the key
+    /// function has changed.
+    void reset() { inner->reset(); }
+
+    /// Given the \a sorted_row_index, this function returns the corresponding row index in the
+    /// source model.
+    int unsorted_row(int sorted_row_index) const
+    {
+        inner->ensure_sorted();
+        return inner->sorted_rows[sorted_row_index];
+    }
+
+    /// Returns the source model of this sort model.
+    std::shared_ptr<Model<ModelData>> source_model() const { return inner->source_model; }
+
+private:
+    std::shared_ptr<private_api::SortByKeyModelInner<ModelData, Key>> inner;
+};
+
+namespace private_api {
+/// The capacity set with set_repeater_recycling_pool_capacity() on the current thread
+inline thread_local std::size_t repeater_recycling_pool_capacity = 0;
+}
+
+/// Sets the maximum number of component instances that each repeater of the current thread keeps
+/// when its rows are removed, when its model is reset, or when they are scrolled out of a
+/// ListView. The kept instances are re-used for new rows instead of being destroyed and created
+/// again. The default of 0 disables recycling.
+///
+/// A re-used instance only gets its model data updated. Any other state of the instance, such as
+/// a property assigned in a callback, is kept from the row it showed before, so only enable this
+/// for delegates whose state comes from the model data. Recycling is specific to the C++ API.
+inline void set_repeater_recycling_pool_capacity(std::size_t capacity)
+{
+    private_api::repeater_recycling_pool_capacity = capacity;
+}
+
 namespace private_api {
 
 template<typename C, typename ModelData>
@@ -1253,20 +2443,92 @@ class Repeater
         std::vector<ComponentWithState> data;
         private_api::Property<bool> is_dirty { true };
 
+        /// Detached instances that can be re-used for new rows
+        std::vector<ComponentHandle<C>> pool;
+
+        /// Moves the instances of the given rows to the pool, as long as there is room left in it.
+        /// The remaining ones are destroyed when the rows are erased.
+        void recycle(typename std::vector<ComponentWithState>::iterator begin,
+                     typename std::vector<ComponentWithState>::iterator end)
+        {
+            auto capacity = repeater_recycling_pool_capacity;
+            if (pool.size() > capacity) {
+                pool.erase(pool.begin() + capacity, pool.end());
+            }
+            for (auto it = begin; it != end && pool.size() < capacity; ++it) {
+                if (it->ptr) {
+                    pool.push_back(std::move(*it->ptr));
+                    it->ptr.reset();
+                }
+            }
+        }
+
+        // The remaining members only make sense for ListView
+        /// The model row of the first component in `data`.
+        int offset = 0;
+        /// The average visible item height.
+        float cached_item_height = 0;
+        /// The viewport_y last time the layout of the ListView was done
+        float previous_viewport_y = 0;
+        /// The position of the item in the row `offset` (which corresponds to `data[0]`).
+        /// We try to keep this constant when re-layouting items
+        float anchor_y = 0;
+
         void row_added(int index, int count) override
         {
+            if (index < offset) {
+                // The instantiated rows are shifted, so all their indexes are dirty
+                offset += count;
+                for (auto &c : data) {
+                    c.state = State::Dirty;
+                }
+                is_dirty.set(true);
+                return;
+            }
+            index -= offset;
+            if (count == 0 || std::size_t(index) > data.size()) {
+                return;
+            }
             is_dirty.set(true);
             data.resize(data.size() + count);
             std::rotate(data.begin() + index, data.end() - count, data.end());
+            for (std::size_t i = index + count; i < data.size(); ++i) {
+                // all the indexes are dirty
+                data[i].state = State::Dirty;
+            }
         }
-        void row_changed(int index) override
+        void row_changed(int index) override { rows_changed(index, 1); }
+        void rows_changed(int index, int count) override
         {
+            int begin = std::max(index - offset, 0);
+            int end = std::min(index + count - offset, int(data.size()));
+            if (begin >= end) {
+                return;
+            }
             is_dirty.set(true);
-            data[index].state = State::Dirty;
+            for (int i = begin; i < end; ++i) {
+                data[i].state = State::Dirty;
+            }
         }
         void row_removed(int index, int count) override
         {
+            if (index < offset) {
+                int removed_before_offset = std::min(count, offset - index);
+                offset -= removed_before_offset;
+                count -= removed_before_offset;
+                index = offset;
+                for (auto &c : data) {
+                    c.state = State::Dirty;
+                }
+                is_dirty.set(true);
+            }
+            index -= offset;
+            if (count == 0 || std::size_t(index) >= data.size()) {
+                return;
+            }
+            count = std::min(count, int(data.size()) - index);
             is_dirty.set(true);
+            recycle(data.begin() + index, data.begin() + index + count);
             data.erase(data.begin() + index, data.begin() + index + count);
             for (std::size_t i = index; i < data.size(); ++i) {
                 // all the indexes are dirty
@@ -1276,45 +2538,78 @@ class Repeater
         void reset() override
         {
             is_dirty.set(true);
+            recycle(data.begin(), data.end());
             data.clear();
+            offset = 0;
         }
     };
 
+    /// Creates a new RepeaterInner for a new model, handing over the instances of the previous
+    /// one to the new pool.
+    void reset_inner() const
+    {
+        auto new_inner = std::make_shared<RepeaterInner>();
+        if (inner) {
+            new_inner->pool = std::move(inner->pool);
+            new_inner->recycle(inner->data.begin(), inner->data.end());
+        }
+        inner = std::move(new_inner);
+        if (auto m = model.get()) {
+            m->attach_peer(inner);
+        }
+    }
+
+    /// Returns a component from the recycling pool, or creates a new one if the pool is empty
+    template<typename Parent>
+    ComponentHandle<C> create_component(const Parent *parent) const
+    {
+        if (!inner->pool.empty()) {
+            auto c = std::move(inner->pool.back());
+            inner->pool.pop_back();
+            return c;
+        }
+        return C::create(parent);
+    }
+
 public:
     // FIXME: should be private, but layouting code uses it.
     mutable std::shared_ptr<RepeaterInner> inner;
 
     template<typename F>
-    void set_model_binding(F &&binding) const
+    void set_model_binding(F &&binding,
+                           private_api::BindingLocation location =
+                                   private_api::BindingLocation::current()) const
     {
-        model.set_binding(std::forward<F>(binding));
+        model.set_binding(std::forward<F>(binding), location);
     }
 
     template<typename Parent>
     void ensure_updated(const Parent *parent) const
     {
         if (model.is_dirty()) {
-            inner = std::make_shared<RepeaterInner>();
-            if (auto m = model.get()) {
-                m->attach_peer(inner);
-            }
+            reset_inner();
         }
 
         if (inner && inner->is_dirty.get()) {
             inner->is_dirty.set(false);
             if (auto m = model.get()) {
                 int count = m->row_count();
+                if (count < int(inner->data.size())) {
+                    inner->recycle(inner->data.begin() + count, inner->data.end());
+                }
                 inner->data.resize(count);
                 for (int i = 0; i < count; ++i) {
                     auto &c = inner->data[i];
                     if (!c.ptr) {
-                        c.ptr = C::create(parent);
+                        c.ptr = create_component(parent);
                     }
                     if (c.state == RepeaterInner::State::Dirty) {
-                        (*c.ptr)->update_data(i, *m->row_data(i));
+                        m->visit_row_data(
+                                i, [&](const auto &data) { (*c.ptr)->update_data(i, data); });
                     }
                 }
             } else {
+                inner->recycle(inner->data.begin(), inner->data.end());
                 inner->data.clear();
             }
         } else {
@@ -1324,18 +2619,191 @@ public:
         }
     }
 
+    /// Same as ensure_updated() but for a ListView: only the components for the rows that are
+    /// visible in the viewport are instantiated and laid out. The height of the viewport is
+    /// estimated from the average height of the visible items.
+    ///
+    /// Note: This "logic" is the same as in Repeater::ensure_updated_listview in model.rs.
     template<typename Parent>
     void ensure_updated_listview(const Parent *parent,
                                  const private_api::Property<float> *viewport_width,
                                  const private_api::Property<float> *viewport_height,
-                                 [[maybe_unused]] const private_api::Property<float> *viewport_y,
-                                 float listview_width, [[maybe_unused]] float listview_height) const
+                                 const private_api::Property<float> *viewport_y,
+                                 float listview_width, float listview_height) const
     {
-        // TODO: the rust code in model.rs try to only allocate as many items as visible items
-        ensure_updated(parent);
+        using State = typename RepeaterInner::State;
+        using ComponentWithState = typename RepeaterInner::ComponentWithState;
 
-        float h = compute_layout_listview(viewport_width, listview_width);
-        viewport_height->set(h);
+        if (model.is_dirty()) {
+            reset_inner();
+        }
+        viewport_width->set(listview_width);
+
+        auto m = model.get();
+        int row_count = m && inner ? m->row_count() : 0;
+        if (inner) {
+            // register the dependency so that we are called again when the model changes
+            inner->is_dirty.get();
+            inner->is_dirty.set(false);
+        }
+        if (row_count == 0) {
+            if (inner) {
+                inner->recycle(inner->data.begin(), inner->data.end());
+                inner->data.clear();
+                inner->offset = 0;
+            }
+            viewport_height->set(0);
+            viewport_y->set(0);
+            return;
+        }
+
+        auto update_component = [&](ComponentWithState &c, int row) {
+            if (!c.ptr) {
+                c.ptr = create_component(parent);
+            }
+            if (c.state == State::Dirty) {
+                m->visit_row_data(row, [&](const auto &data) { (*c.ptr)->update_data(row, data); });
+                c.state = State::Clean;
+            }
+        };
+        auto item_height = [&](const ComponentWithState &c) {
+            float h = 0;
+            (*c.ptr)->listview_layout(&h, viewport_width);
+            return h;
+        };
+
+        float vp_y = std::min(viewport_y->get(), 0.f);
+
+        // We need some sort of estimation of the element height
+        float element_height = inner->cached_item_height;
+        if (element_height <= 0) {
+            float total_height = 0;
+            int count = 0;
+            for (auto &c : inner->data) {
+                if (c.ptr) {
+                    total_height += item_height(c);
+                    ++count;
+                }
+            }
+            if (count > 0) {
+                element_height = total_height / count;
+            } else {
+                // There seems to be currently no items. Just instantiate one item.
+                inner->offset = std::min(inner->offset, row_count - 1);
+                inner->data.resize(1);
+                update_component(inner->data[0], inner->offset);
+                element_height = item_height(inner->data[0]);
+            }
+        }
+
+        const float one_and_a_half_screen = listview_height * 3 / 2;
+        const float first_item_y = inner->anchor_y;
+        const float last_item_bottom = first_item_y + element_height * inner->data.size();
+
+        int new_offset = inner->offset;
+        float new_offset_y = first_item_y;
+        if (first_item_y > -vp_y + one_and_a_half_screen
+            || last_item_bottom + element_height < -vp_y) {
+            // We are jumping more than 1.5 screens, consider this as a random seek.
+            inner->recycle(inner->data.begin(), inner->data.end());
+            inner->data.clear();
+            inner->offset = element_height > 0
+                    ? std::min(int(std::floor(-vp_y / element_height)), row_count - 1)
+                    : 0;
+            new_offset = inner->offset;
+            new_offset_y = -vp_y;
+        } else if (vp_y < inner->previous_viewport_y) {
+            // We scrolled down, try to find out the new offset.
+            for (auto &c : inner->data) {
+                update_component(c, new_offset);
+                float h = item_height(c);
+                if (new_offset_y + h >= -vp_y || new_offset + 1 >= row_count) {
+                    break;
+                }
+                new_offset_y += h;
+                ++new_offset;
+            }
+        }
+        // Otherwise we scrolled up, we'll instantiate items before offset in the loop
+
+        while (true) {
+            // If there is a gap before the new_offset and the beginning of the visible viewport,
+            // try to fill it with items. First look at items that are before new_offset in
+            // inner->data, if any.
+            while (new_offset > inner->offset && new_offset_y > -vp_y) {
+                --new_offset;
+                auto &c = inner->data[new_offset - inner->offset];
+                update_component(c, new_offset);
+                new_offset_y -= item_height(c);
+            }
+            // If there is still a gap, fill it with new components before
+            std::vector<ComponentWithState> new_components;
+            while (new_offset > 0 && new_offset_y > -vp_y) {
+                --new_offset;
+                ComponentWithState c;
+                update_component(c, new_offset);
+                new_offset_y -= item_height(c);
+                new_components.push_back(std::move(c));
+            }
+            if (!new_components.empty()) {
+                inner->data.insert(inner->data.begin(),
+                                   std::make_move_iterator(new_components.rbegin()),
+                                   std::make_move_iterator(new_components.rend()));
+                inner->offset = new_offset;
+            }
+
+            // Now layout items until we fit the view, starting with the ones that are already
+            // instantiated
+            float y = new_offset_y;
+            int idx = new_offset;
+            for (auto it = inner->data.begin() + (new_offset - inner->offset);
+                 it != inner->data.end(); ++it) {
+                update_component(*it, idx);
+                (*it->ptr)->listview_layout(&y, viewport_width);
+                ++idx;
+                if (y >= -vp_y + listview_height) {
+                    break;
+                }
+            }
+
+            // Create more items until there is no more room.
+            while (y < -vp_y + listview_height && idx < row_count) {
+                ComponentWithState c;
+                update_component(c, idx);
+                (*c.ptr)->listview_layout(&y, viewport_width);
+                inner->data.push_back(std::move(c));
+                ++idx;
+            }
+            if (y < -vp_y + listview_height && vp_y < 0) {
+                // We reached the end of the model, and we still have room. Scroll a bit up.
+                vp_y = listview_height - y;
+                continue;
+            }
+
+            // Cleanup the components that are not shown.
+            if (new_offset != inner->offset) {
+                auto end = inner->data.begin() + (new_offset - inner->offset);
+                inner->recycle(inner->data.begin(), end);
+                inner->data.erase(inner->data.begin(), end);
+                inner->offset = new_offset;
+            }
+            if (int(inner->data.size()) != idx - new_offset) {
+                auto begin = inner->data.begin() + (idx - new_offset);
+                inner->recycle(begin, inner->data.end());
+                inner->data.erase(begin, inner->data.end());
+            }
+
+            // Now re-compute some coordinates such that the scrollbars are adjusted.
+            if (!inner->data.empty()) {
+                inner->cached_item_height = (y - new_offset_y) / inner->data.size();
+            }
+            inner->anchor_y = inner->cached_item_height * inner->offset;
+            viewport_height->set(inner->cached_item_height * row_count);
+            float new_viewport_y = -inner->anchor_y + vp_y + new_offset_y;
+            viewport_y->set(new_viewport_y);
+            inner->previous_viewport_y = new_viewport_y;
+            break;
+        }
     }
 
     uintptr_t visit(TraversalOrder order, private_api::ItemVisitorRefMut visitor) const
@@ -1359,26 +2827,14 @@ public:
 
     vtable::VWeak<private_api::ComponentVTable> component_at(int i) const
     {
-        const auto &x = inner->data.at(i);
+        const auto &x = inner->data.at(i - inner->offset);
         return vtable::VWeak<private_api::ComponentVTable> { x.ptr->into_dyn() };
     }
 
     private_api::IndexRange index_range() const
     {
-        return private_api::IndexRange { 0, inner->data.size() };
-    }
-
-    float compute_layout_listview(const private_api::Property<float> *viewport_width,
-                                  float listview_width) const
-    {
-        float offset = 0;
-        viewport_width->set(listview_width);
-        if (!inner)
-            return offset;
-        for (auto &x : inner->data) {
-            (*x.ptr)->listview_layout(&offset, viewport_width);
-        }
-        return offset;
+        return private_api::IndexRange { std::size_t(inner->offset),
+                                         inner->offset + inner->data.size() };
     }
 
     void model_set_row_data(int row, const ModelData &data) const
@@ -1389,10 +2845,12 @@ public:
         if (auto m = model.get()) {
             if (row < m->row_count()) {
                 m->set_row_data(row, data);
-                if (inner && inner->is_dirty.get()) {
-                    auto &c = inner->data[row];
+                if (inner && inner->is_dirty.get() && row >= inner->offset
+                    && std::size_t(row - inner->offset) < inner->data.size()) {
+                    auto &c = inner->data[row - inner->offset];
                     if (c.state == RepeaterInner::State::Dirty && c.ptr) {
-                        (*c.ptr)->update_data(row, *m->row_data(row));
+                        m->visit_row_data(
+                                row, [&](const auto &data) { (*c.ptr)->update_data(row, data); });
                     }
                 }
             }
@@ -1446,6 +2904,9 @@ inline void run_event_loop()
 /// to be called from callbacks triggered by the UI. After calling the function,
 /// it will return immediately and once control is passed back to the event loop,
 /// the initial call to slint::run_event_loop() will return.
+///
+/// When called from a thread that runs its own event loop, see EventLoopContext, it is that
+/// event loop that is terminated.
 inline void quit_event_loop()
 {
     cbindgen_private::slint_quit_event_loop();
@@ -1488,10 +2949,12 @@ inline void quit_event_loop()
 /// ```
 ///
 /// See also blocking_invoke_from_event_loop() for a blocking version of this function
+///
+/// \returns false, after destroying \a f, if there is no main event loop or if it was terminated
 template<typename Functor>
-void invoke_from_event_loop(Functor f)
+bool invoke_from_event_loop(Functor f)
 {
-    cbindgen_private::slint_post_event(
+    return cbindgen_private::slint_post_event(
             [](void *data) { (*reinterpret_cast<Functor *>(data))(); }, new Functor(std::move(f)),
             [](void *data) { delete reinterpret_cast<Functor *>(data); });
 }
@@ -1504,7 +2967,9 @@ void invoke_from_event_loop(Functor f)
 ///
 /// This function must be called from a different thread than the thread that runs the event loop
 /// otherwise it will result in a deadlock. Calling this function if the event loop is not running
-/// will also block forever or until the event loop is started in another thread.
+/// will also block forever or until the event loop is started in another thread. If there is no
+/// main event loop or if it was terminated, a std::future_error with
+/// std::future_errc::broken_promise is thrown.
 ///
 /// The following example is reading the message property from a thread
 ///
@@ -1538,12 +3003,14 @@ auto blocking_invoke_from_event_loop(Functor f) -> std::invoke_result_t<Functor>
     std::optional<std::invoke_result_t<Functor>> result;
     std::mutex mtx;
     std::condition_variable cv;
-    invoke_from_event_loop([&] {
-        auto r = f();
-        std::unique_lock lock(mtx);
-        result = std::move(r);
-        cv.notify_one();
-    });
+    if (!invoke_from_event_loop([&] {
+            auto r = f();
+            std::unique_lock lock(mtx);
+            result = std::move(r);
+            cv.notify_one();
+        })) {
+        throw std::future_error(std::future_errc::broken_promise);
+    }
     std::unique_lock lock(mtx);
     cv.wait(lock, [&] { return result.has_value(); });
     return std::move(*result);
@@ -1556,14 +3023,596 @@ auto blocking_invoke_from_event_loop(Functor f) -> void
     std::mutex mtx;
     std::condition_variable cv;
     bool ok = false;
-    invoke_from_event_loop([&] {
-        f();
-        std::unique_lock lock(mtx);
-        ok = true;
-        cv.notify_one();
-    });
+    if (!invoke_from_event_loop([&] {
+            f();
+            std::unique_lock lock(mtx);
+            ok = true;
+            cv.notify_one();
+        })) {
+        throw std::future_error(std::future_errc::broken_promise);
+    }
     std::unique_lock lock(mtx);
     cv.wait(lock, [&] { return ok; });
 }
 
+/// Non-blocking version of invoke_from_event_loop() that gives access to the result
+///
+/// Just like invoke_from_event_loop(), this will run the specified functor from the thread running
+/// the slint event loop. It returns immediately with a std::future that becomes ready with the
+/// value returned by the functor, or with the exception it has thrown, once it has run. Unlike
+/// blocking_invoke_from_event_loop(), the calling thread can keep on working and only waits
+/// when it needs the result.
+///
+/// If the functor is dropped without being run, for example because the event loop is never
+/// started again, the future holds a std::future_error with std::future_errc::broken_promise.
+///
+/// ```
+/// std::thread worker_thread([ui]{
+///     auto message = slint::async_invoke_from_event_loop([ui]() {
+///         return ui->get_message();
+///     });
+///     auto data = read_data_from_disk();
+///     process(data, message.get());
+/// });
+/// ```
+template<typename Functor>
+auto async_invoke_from_event_loop(Functor f) -> std::future<std::invoke_result_t<Functor>>
+{
+    std::packaged_task<std::invoke_result_t<Functor>()> task(std::move(f));
+    auto result = task.get_future();
+    invoke_from_event_loop(std::move(task));
+    return result;
+}
+
+/// A handle to the event loop of a thread, that can be copied to other threads to run functors
+/// in that event loop.
+///
+/// Each thread that registers a platform runs its own event loop, with its own windows, timers and
+/// components, so that independent user interfaces, for example one on each display, run in
+/// parallel. invoke_from_event_loop() targets the main event loop, the one of the platform
+/// registered with platform::Platform::set_platform(), and an EventLoopContext the one of any
+/// thread, including the threads that called platform::Platform::set_thread_platform().
+///
+/// The backends that use a windowing system only support one event loop, on the main thread. The
+/// other threads need a platform of their own, that renders with a platform::SoftwareWindow.
+///
+/// ```
+/// std::vector<std::thread> displays;
+/// std::vector<std::future<slint::EventLoopContext>> contexts;
+/// for (int i = 0; i < 4; ++i) {
+///     std::promise<slint::EventLoopContext> context;
+///     contexts.push_back(context.get_future());
+///     displays.emplace_back([i, context = std::move(context)]() mutable {
+///         slint::platform::Platform::set_thread_platform(std::make_unique<DisplayPlatform>(i));
+///         auto ui = DisplayUI::create();
+///         context.set_value(*slint::EventLoopContext::current());
+///         ui->run();
+///     });
+/// }
+/// contexts[2].get().invoke_from_event_loop([] { /* runs in the thread of the third display */ });
+/// ```
+class EventLoopContext
+{
+public:
+    /// Returns the event loop of the calling thread, or std::nullopt if no platform was registered
+    /// on this thread.
+    static std::optional<EventLoopContext> current()
+    {
+        if (auto inner = cbindgen_private::slint_event_loop_context_current()) {
+            return EventLoopContext(inner);
+        }
+        return {};
+    }
+
+    EventLoopContext(const EventLoopContext &other)
+        : inner(cbindgen_private::slint_event_loop_context_clone(other.inner))
+    {
+    }
+    EventLoopContext &operator=(const EventLoopContext &other)
+    {
+        if (this != &other) {
+            cbindgen_private::slint_event_loop_context_drop(inner);
+            inner = cbindgen_private::slint_event_loop_context_clone(other.inner);
+        }
+        return *this;
+    }
+    ~EventLoopContext() { cbindgen_private::slint_event_loop_context_drop(inner); }
+
+    /// Adds \a f to the queue of this event loop, to be invoked from its thread, like
+    /// slint::invoke_from_event_loop() does for the main event loop. This function is
+    /// thread-safe.
+    /// \returns false, after destroying \a f, if the event loop was terminated
+    template<std::invocable Functor>
+    bool invoke_from_event_loop(Functor f) const
+    {
+        return cbindgen_private::slint_event_loop_context_post_event(
+                inner, [](void *data) { (*reinterpret_cast<Functor *>(data))(); },
+                new Functor(std::move(f)),
+                [](void *data) { delete reinterpret_cast<Functor *>(data); });
+    }
+
+    /// Schedules this event loop for termination. This function is thread-safe.
+    /// \returns false if the event loop was terminated already
+    bool quit_event_loop() const { return cbindgen_private::slint_event_loop_context_quit(inner); }
+
+private:
+    explicit EventLoopContext(cbindgen_private::EventLoopContextOpaque inner) : inner(inner) { }
+    cbindgen_private::EventLoopContextOpaque inner;
+};
+
+namespace private_api {
+/// Invokes \a f from the event loop of \a context, or from the main event loop if it is empty.
+/// Used with the EventLoopContext::current() of a thread, to get back to it from other threads.
+template<typename Functor>
+bool invoke_from_event_loop(const std::optional<EventLoopContext> &context, Functor f)
+{
+    if (context) {
+        return context->invoke_from_event_loop(std::move(f));
+    }
+    return slint::invoke_from_event_loop(std::move(f));
+}
+}
+
+namespace private_api {
+
+/// Pool of threads decoding the images passed to load_image_from_path_async(). Threads are
+/// started as needed, up to one less than the number of cores.
+///
+/// The threads are detached and share the state of the queue, so that exiting the program doesn't
+/// wait for the images being decoded. Once the queue is destroyed at exit, the pending jobs are
+/// dropped and the jobs still running don't deliver their result.
+class ImageDecodeQueue
+{
+public:
+    /// A job runs in a thread of the pool, and returns the function that delivers its result
+    using Job = std::function<std::function<void()>()>;
+
+    static ImageDecodeQueue &instance()
+    {
+        static ImageDecodeQueue queue;
+        return queue;
+    }
+
+    void push(Job job)
+    {
+        {
+            std::unique_lock lock(state->mutex);
+            state->jobs.push_back(std::move(job));
+            if (state->idle_count == 0 && state->worker_count < state->max_workers) {
+                ++state->worker_count;
+                std::thread([state = state] { run(state); }).detach();
+            }
+        }
+        state->cv.notify_one();
+    }
+
+    ~ImageDecodeQueue()
+    {
+        {
+            std::unique_lock lock(state->mutex);
+            state->stopping = true;
+            state->jobs.clear();
+        }
+        state->cv.notify_all();
+    }
+
+private:
+    struct State
+    {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::deque<Job> jobs;
+        std::size_t worker_count = 0;
+        std::size_t idle_count = 0;
+        std::size_t max_workers = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+        bool stopping = false;
+    };
+
+    ImageDecodeQueue() = default;
+
+    static void run(std::shared_ptr<State> state)
+    {
+        std::unique_lock lock(state->mutex);
+        for (;;) {
+            ++state->idle_count;
+            state->cv.wait(lock, [&] { return state->stopping || !state->jobs.empty(); });
+            --state->idle_count;
+            if (state->stopping) {
+                return;
+            }
+            auto job = std::move(state->jobs.front());
+            state->jobs.pop_front();
+            lock.unlock();
+            auto deliver = job();
+            lock.lock();
+            // Delivering with the lock held, so that the queue can't be destroyed meanwhile
+            if (state->stopping) {
+                return;
+            }
+            deliver();
+        }
+    }
+
+    std::shared_ptr<State> state = std::make_shared<State>();
+};
+
+} // namespace private_api
+
+/// Decodes the image file at \a file_path on a background thread, and then invokes \a on_loaded
+/// with the image from the event loop of the calling thread, see EventLoopContext, or from the
+/// main event loop if the calling thread doesn't run one. If the image could not be loaded,
+/// \a on_loaded is invoked with an empty image.
+///
+/// If \a max_size is not empty the image is downscaled after decoding to fit in it, see
+/// Image::decode_from_path(). Decoded images are cached, so loading the same file again with the
+/// same \a max_size is fast. SVG files are loaded with Image::load_from_path() from the event
+/// loop instead.
+///
+/// Show a placeholder until the image is decoded by setting it on the property first:
+///
+/// ```
+/// ui->set_thumbnail(placeholder);
+/// slint::load_image_from_path_async(
+///         path,
+///         [weak_ui = slint::ComponentWeakHandle(ui)](slint::Image image) {
+///             if (auto ui = weak_ui.lock()) {
+///                 (*ui)->set_thumbnail(image);
+///             }
+///         },
+///         { 128, 128 });
+/// ```
+inline void load_image_from_path_async(SharedString file_path,
+                                       std::function<void(Image)> on_loaded,
+                                       Size<uint32_t> max_size = {})
+{
+    auto context = EventLoopContext::current();
+    if (file_path.ends_with(".svg") || file_path.ends_with(".svgz")) {
+        private_api::invoke_from_event_loop(
+                context, [file_path = std::move(file_path), on_loaded = std::move(on_loaded)] {
+                    on_loaded(Image::load_from_path(file_path));
+                });
+        return;
+    }
+    private_api::ImageDecodeQueue::instance().push(
+            [file_path = std::move(file_path), on_loaded = std::move(on_loaded), max_size,
+             context = std::move(context)]() mutable -> std::function<void()> {
+                auto image = Image::decode_from_path(file_path, max_size);
+                return [image = std::move(image), on_loaded = std::move(on_loaded),
+                        context = std::move(context)] {
+                    private_api::invoke_from_event_loop(
+                            context, [image, on_loaded] { on_loaded(image); });
+                };
+            });
+}
+
+#if defined(__cpp_impl_coroutine) || defined(DOXYGEN)
+/// Returns an awaitable that suspends the current C++20 coroutine and resumes it from the
+/// event loop of the thread that calls this function, see EventLoopContext, or from the main
+/// event loop if that thread doesn't run one.
+///
+/// This allows code running in a coroutine to hop to the event loop in order to access the UI,
+/// and to hop back to a thread pool with resume_on() to continue with work that shouldn't block
+/// the UI:
+///
+/// ```
+/// my_task refresh(slint::ComponentWeakHandle<MyApplicationUI> weak_ui) {
+///     auto data = co_await fetch_data_async();
+///     co_await slint::resume_on_event_loop();
+///     if (auto ui = weak_ui.lock()) {
+///         (*ui)->set_data(data);
+///     }
+///     co_await slint::resume_on(thread_pool_executor);
+///     ...
+/// }
+/// ```
+///
+/// If the event loop never runs again, the coroutine stays suspended and is not destroyed.
+inline auto resume_on_event_loop()
+{
+    struct Awaiter
+    {
+        std::optional<EventLoopContext> context;
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle) const
+        {
+            private_api::invoke_from_event_loop(context, [handle] { handle.resume(); });
+        }
+        void await_resume() const noexcept { }
+    };
+    return Awaiter { EventLoopContext::current() };
+}
+
+/// Returns an awaitable that suspends the current C++20 coroutine and resumes it with
+/// \a executor, for example to go back from the event loop to a thread pool.
+///
+/// \a executor is called once with a functor taking no argument that resumes the coroutine,
+/// and is expected to invoke it on the thread where the coroutine should continue.
+template<typename Executor>
+auto resume_on(Executor executor)
+{
+    struct Awaiter
+    {
+        Executor executor;
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            executor([handle] { handle.resume(); });
+        }
+        void await_resume() const noexcept { }
+    };
+    return Awaiter { std::move(executor) };
+}
+#endif
+
+namespace private_api {
+
+template<typename T>
+struct UpdateChannelInner : std::enable_shared_from_this<UpdateChannelInner<T>>
+{
+    static constexpr uint32_t npos = std::numeric_limits<uint32_t>::max();
+
+    struct Node
+    {
+        std::optional<T> value;
+        std::atomic<uint32_t> next = npos;
+    };
+
+    struct Slot
+    {
+        /// Index of the node holding the latest value posted for this key, or npos
+        std::atomic<uint32_t> pending = npos;
+        /// True while the slot is in the dirty list
+        std::atomic<bool> queued = false;
+        std::atomic<uint32_t> next_dirty = npos;
+    };
+
+    // Indexes are stored as uint32_t with npos as a marker, and each key needs its own node
+    // with at least one more for the value being posted.
+    UpdateChannelInner(std::size_t key_count, std::size_t pool_size,
+                       std::function<void(std::size_t, T)> handler)
+        : key_count(std::min<std::size_t>(key_count, npos - 1)),
+          pool_size(std::clamp<std::size_t>(pool_size, this->key_count + 1, npos)),
+          nodes(new Node[this->pool_size]),
+          slots(new Slot[this->key_count]),
+          handler(std::move(handler)),
+          context(EventLoopContext::current()),
+          event_loop_thread(context ? std::this_thread::get_id() : std::thread::id {})
+    {
+        for (std::size_t i = 0; i + 1 < this->pool_size; ++i) {
+            nodes[i].next.store(uint32_t(i + 1), std::memory_order_relaxed);
+        }
+        free_head.store(0, std::memory_order_relaxed);
+    }
+
+    // The free list head packs a tag in the upper 32 bits, bumped on every change, so that a
+    // node popped and pushed back in the meantime doesn't let a stale compare_exchange succeed.
+    static uint64_t retag(uint64_t head, uint32_t index)
+    {
+        return (((head >> 32) + 1) << 32) | index;
+    }
+
+    uint32_t pop_node()
+    {
+        auto head = free_head.load(std::memory_order_acquire);
+        for (;;) {
+            auto index = uint32_t(head);
+            if (index == npos) {
+                // Every node is pending or being posted. The event loop thread handles the
+                // pending values itself, because it would never get to do it while waiting.
+                // Other threads wait for the event loop or another producer to free one.
+                if (event_loop_thread.load(std::memory_order_relaxed)
+                    == std::this_thread::get_id()) {
+                    drain();
+                } else {
+                    std::this_thread::yield();
+                }
+                head = free_head.load(std::memory_order_acquire);
+                continue;
+            }
+            auto next = nodes[index].next.load(std::memory_order_relaxed);
+            if (free_head.compare_exchange_weak(head, retag(head, next),
+                                                std::memory_order_acquire,
+                                                std::memory_order_acquire)) {
+                return index;
+            }
+        }
+    }
+
+    void release_node(uint32_t index)
+    {
+        nodes[index].value.reset();
+        auto head = free_head.load(std::memory_order_relaxed);
+        do {
+            nodes[index].next.store(uint32_t(head), std::memory_order_relaxed);
+        } while (!free_head.compare_exchange_weak(head, retag(head, index),
+                                                  std::memory_order_release,
+                                                  std::memory_order_relaxed));
+    }
+
+    void post(std::size_t key, T value)
+    {
+        if (key >= key_count) {
+            return;
+        }
+        auto index = pop_node();
+        nodes[index].value.emplace(std::move(value));
+        auto &slot = slots[key];
+        if (auto replaced = slot.pending.exchange(index); replaced != npos) {
+            release_node(replaced);
+        }
+        if (!slot.queued.exchange(true)) {
+            auto head = dirty_head.load();
+            do {
+                slot.next_dirty.store(head, std::memory_order_relaxed);
+            } while (!dirty_head.compare_exchange_weak(head, uint32_t(key)));
+        }
+        if (!wakeup_pending.exchange(true)) {
+            private_api::invoke_from_event_loop(
+                    context, [self = this->shared_from_this()] { self->drain(); });
+        }
+    }
+
+    void drain()
+    {
+        event_loop_thread.store(std::this_thread::get_id(), std::memory_order_relaxed);
+        wakeup_pending.store(false);
+        // Producers push at the front of the list, reverse it so that keys are handled in the
+        // order in which they were first posted.
+        uint32_t key = dirty_head.exchange(npos);
+        uint32_t reversed = npos;
+        while (key != npos) {
+            auto next = slots[key].next_dirty.load(std::memory_order_relaxed);
+            slots[key].next_dirty.store(reversed, std::memory_order_relaxed);
+            reversed = key;
+            key = next;
+        }
+
+        for (key = reversed; key != npos;) {
+            auto &slot = slots[key];
+            // Once queued is reset, a producer may push the slot again and overwrite next_dirty
+            auto next = slot.next_dirty.load(std::memory_order_relaxed);
+            slot.queued.store(false);
+            if (auto index = slot.pending.exchange(npos); index != npos) {
+                T value = std::move(*nodes[index].value);
+                release_node(index);
+                handler(key, std::move(value));
+            }
+            key = next;
+        }
+    }
+
+    std::size_t key_count;
+    std::size_t pool_size;
+    std::unique_ptr<Node[]> nodes;
+    std::unique_ptr<Slot[]> slots;
+    std::function<void(std::size_t, T)> handler;
+    /// The event loop of the thread that created the channel, if it runs one
+    std::optional<EventLoopContext> context;
+    /// The thread that last handled the values. Until then, the thread that created the channel
+    /// if it runs an event loop, or no thread otherwise.
+    std::atomic<std::thread::id> event_loop_thread;
+    std::atomic<uint64_t> free_head;
+    std::atomic<uint32_t> dirty_head = npos;
+    std::atomic<bool> wakeup_pending = false;
+};
+
+} // namespace private_api
+
+/// An UpdateChannel forwards values from any number of threads to a handler invoked from the
+/// event loop of the thread that created the channel, see EventLoopContext, or from the main
+/// event loop if that thread doesn't run one, coalescing them per key.
+///
+/// Keys are indexes in the range `[0, key_count)`, for example one per sensor or per property
+/// to update. When several values are posted for the same key before the event loop gets to
+/// handle them, only the latest one is passed to the handler. All keys with pending values are
+/// handled from a single invocation in the event loop, in the order in which they were first
+/// posted, so the work done by the UI thread is bounded by the number of keys no matter how
+/// fast the producers are.
+///
+/// Posting doesn't lock, and only allocates for the first value since the last time the event
+/// loop handled the channel: the values are stored in a pool of \a pool_size nodes preallocated
+/// when the channel is created. The pool holds at least one more node than there are keys; when
+/// it is exhausted post() yields until a node is released, so it should also account for the
+/// number of threads posting at the same time. A post() from the thread running the event loop
+/// doesn't wait, it handles the pending values first. That thread is known once the event loop
+/// handled the channel. Until then, it is assumed to be the thread that created the channel if
+/// that thread runs an event loop, see EventLoopContext, and every post() waits otherwise.
+/// Superseded values are destroyed in the thread that replaced them.
+///
+/// ```
+/// slint::UpdateChannel<float> readings(sensor_count, [weak_ui](std::size_t sensor, float value) {
+///     if (auto ui = weak_ui.lock()) {
+///         (*ui)->get_readings()->set_row_data(sensor, value);
+///     }
+/// });
+/// std::thread sensor_thread([readings] {
+///     while (...) {
+///         readings.post(sensor_index, read_sensor(sensor_index));
+///     }
+/// });
+/// ```
+///
+/// The channel can be copied, copies post to the same keys. Pending values are still handled
+/// after the last copy went out of scope.
+template<typename T>
+class UpdateChannel
+{
+public:
+    /// Creates a channel for \a key_count keys whose values are passed to \a handler.
+    /// If \a pool_size is 0, the pool holds enough nodes for 64 concurrent producers.
+    UpdateChannel(std::size_t key_count, std::function<void(std::size_t key, T value)> handler,
+                  std::size_t pool_size = 0)
+        : inner(std::make_shared<private_api::UpdateChannelInner<T>>(
+                key_count, pool_size ? pool_size : key_count + 64, std::move(handler)))
+    {
+    }
+
+    /// Queues \a value for \a key, replacing any value that was not handled yet. This function
+    /// is thread-safe and can be called from any thread, including the one running the event
+    /// loop. Values for a key that is not smaller than key_count() are ignored.
+    void post(std::size_t key, T value) const { inner->post(key, std::move(value)); }
+
+    /// Returns the number of keys of this channel.
+    std::size_t key_count() const { return inner->key_count; }
+
+private:
+    std::shared_ptr<private_api::UpdateChannelInner<T>> inner;
+};
+
+#if defined(SLINT_FEATURE_BINDING_PROFILER) || defined(DOXYGEN)
+/// The binding profiler records each evaluation of a binding in the current thread, with the
+/// location in the generated code that set the binding, its duration, and the properties it
+/// depends on. It is only available when Slint is built with the `SLINT_FEATURE_BINDING_PROFILER`
+/// CMake option, and records nothing until start() is called.
+///
+/// ```
+/// slint::binding_profiler::start();
+/// ui->run();
+/// slint::binding_profiler::stop();
+/// std::cout << slint::binding_profiler::summary();
+/// std::ofstream("bindings.json") << slint::binding_profiler::chrome_trace();
+/// ```
+namespace binding_profiler {
+
+/// Starts recording, in addition to what was recorded since the last call to reset().
+inline void start()
+{
+    cbindgen_private::slint_binding_profiler_start();
+}
+
+/// Stops recording, keeping what was recorded so far.
+inline void stop()
+{
+    cbindgen_private::slint_binding_profiler_stop();
+}
+
+/// Discards everything that was recorded.
+inline void reset()
+{
+    cbindgen_private::slint_binding_profiler_reset();
+}
+
+/// Returns the recorded evaluations in the JSON trace event format, which can be opened in
+/// `chrome://tracing` or in the Perfetto UI. The properties a binding depends on are listed
+/// in the arguments of its events.
+inline SharedString chrome_trace()
+{
+    SharedString result;
+    cbindgen_private::slint_binding_profiler_chrome_trace(&result);
+    return result;
+}
+
+/// Returns a table of the \a max_rows bindings that spent the most time evaluating, excluding
+/// the bindings they depend on, with their number of evaluations per second of recording and
+/// the properties they depend on.
+inline SharedString summary(std::size_t max_rows = 20)
+{
+    SharedString result;
+    cbindgen_private::slint_binding_profiler_summary(max_rows, &result);
+    return result;
+}
+
+} // namespace binding_profiler
+#endif
+
 } // namespace slint
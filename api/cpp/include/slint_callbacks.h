@@ -3,10 +3,63 @@
 
 #pragma once
 #include <tuple>
+#include <type_traits>
 #include "slint_properties_internal.h"
+#include "slint_closure.h"
 
 namespace slint::private_api {
 
+namespace callback_detail {
+
+/// Passed as the return value pointer by Callback::call(), to tell the handler that the argument
+/// is a ForwardedCall. The native items call the handlers from Rust with a pointer to a tuple of
+/// values and a pointer to their return value, which is never this odd address.
+inline void *const forwarded_call_tag = reinterpret_cast<void *>(0x3);
+
+/// The argument of a handler called from C++: references to the arguments, which are therefore
+/// not copied, and a pointer to the return value.
+template<typename Ret, typename... Arg>
+struct ForwardedCall
+{
+    std::tuple<const Arg &...> args;
+    Ret *ret;
+};
+
+template<typename Ret, typename... Arg, typename F>
+void set_handler(const cbindgen_private::CallbackOpaque *inner, F binding)
+{
+    using Storage = ClosureStorage<F, const Arg &...>;
+    cbindgen_private::slint_callback_set_handler(
+            inner,
+            [](void *user_data, const void *arg, void *ret) {
+                Storage::visit(user_data, [&](auto &f) {
+                    if (ret == forwarded_call_tag) {
+                        auto call = reinterpret_cast<const ForwardedCall<Ret, Arg...> *>(arg);
+                        if constexpr (std::is_void_v<Ret>) {
+                            std::apply(f, call->args);
+                        } else {
+                            *call->ret = std::apply(f, call->args);
+                        }
+                    } else if constexpr (std::is_void_v<Ret>) {
+                        std::apply(f, *reinterpret_cast<const std::tuple<Arg...> *>(arg));
+                    } else {
+                        *reinterpret_cast<Ret *>(ret) = std::apply(
+                                f, *reinterpret_cast<const std::tuple<Arg...> *>(arg));
+                    }
+                });
+            },
+            Storage::create(std::move(binding)), Storage::drop);
+}
+
+template<typename Ret, typename... Arg>
+void call(const cbindgen_private::CallbackOpaque *inner, Ret *ret, const Arg &...arg)
+{
+    ForwardedCall<Ret, Arg...> forwarded { { arg... }, ret };
+    cbindgen_private::slint_callback_call(inner, &forwarded, forwarded_call_tag);
+}
+
+} // namespace callback_detail
+
 /// A Callback stores a function pointer with no parameters and no return value.
 /// It's possible to set that pointer via set_handler() and it can be invoked via call(). This is
 /// used to implement callbacks in the `.slint` language.
@@ -27,32 +80,23 @@ struct Callback<Ret(Arg...)>
     Callback &operator=(const Callback &) = delete;
 
     /// Sets a new handler \a binding for this callback, that will be invoked when call() is called.
+    /// Small handlers that capture no more than a pointer are stored without allocation.
     template<typename F>
     void set_handler(F binding) const
     {
-        cbindgen_private::slint_callback_set_handler(
-                &inner,
-                [](void *user_data, const void *arg, void *ret) {
-                    *reinterpret_cast<Ret *>(ret) =
-                            std::apply(*reinterpret_cast<F *>(user_data),
-                                       *reinterpret_cast<const Tuple *>(arg));
-                },
-                new F(std::move(binding)),
-                [](void *user_data) { delete reinterpret_cast<F *>(user_data); });
+        callback_detail::set_handler<Ret, Arg...>(&inner, std::move(binding));
     }
 
     /// Invokes a previously set handler with the parameters \a arg and returns the return value of
-    /// the handler.
+    /// the handler. The parameters are passed to the handler by reference, without copies.
     Ret call(const Arg &...arg) const
     {
         Ret r {};
-        Tuple tuple { arg... };
-        cbindgen_private::slint_callback_call(&inner, &tuple, &r);
+        callback_detail::call(&inner, &r, arg...);
         return r;
     }
 
 private:
-    using Tuple = std::tuple<Arg...>;
     cbindgen_private::CallbackOpaque inner;
 };
 
@@ -71,28 +115,21 @@ struct Callback<void(Arg...)>
     Callback &operator=(const Callback &) = delete;
 
     /// Sets a new handler \a binding for this callback, that will be invoked when call() is called.
+    /// Small handlers that capture no more than a pointer are stored without allocation.
     template<typename F>
     void set_handler(F binding) const
     {
-        cbindgen_private::slint_callback_set_handler(
-                &inner,
-                [](void *user_data, const void *arg, void *) {
-                    std::apply(*reinterpret_cast<F *>(user_data),
-                               *reinterpret_cast<const Tuple *>(arg));
-                },
-                new F(std::move(binding)),
-                [](void *user_data) { delete reinterpret_cast<F *>(user_data); });
+        callback_detail::set_handler<void, Arg...>(&inner, std::move(binding));
     }
 
-    /// Invokes a previously set handler with the parameters \a arg.
+    /// Invokes a previously set handler with the parameters \a arg. The parameters are passed to
+    /// the handler by reference, without copies.
     void call(const Arg &...arg) const
     {
-        Tuple tuple { arg... };
-        cbindgen_private::slint_callback_call(&inner, &tuple, reinterpret_cast<void *>(0x1));
+        callback_detail::call<void>(&inner, nullptr, arg...);
     }
 
 private:
-    using Tuple = std::tuple<Arg...>;
     cbindgen_private::CallbackOpaque inner;
 };
 
@@ -0,0 +1,56 @@
+// Copyright © SixtyFPS GmbH <info@slint-ui.com>
+// SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-Slint-commercial
+
+#pragma once
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace slint::private_api {
+
+/// Stores a closure \a F called with arguments of type \a Arg in the `void *user_data` that the
+/// FFI functions taking a function pointer, a user data and a function to drop the user data pass
+/// back.
+///
+/// Closures that fit in a pointer and don't mutate their state, such as the `[this]` lambdas of
+/// the generated code, are stored in the pointer itself: they are neither allocated nor dropped.
+template<typename F, typename... Arg>
+struct ClosureStorage
+{
+    static constexpr bool is_inline = sizeof(F) <= sizeof(void *) && alignof(F) <= alignof(void *)
+            && std::is_trivially_copyable_v<F> && std::is_invocable_v<const F &, Arg...>;
+
+    /// Returns the user data holding \a closure
+    static void *create(F closure)
+    {
+        if constexpr (is_inline) {
+            void *user_data = nullptr;
+            std::memcpy(&user_data, &closure, sizeof(F));
+            return user_data;
+        } else {
+            return new F(std::move(closure));
+        }
+    }
+
+    /// The function that drops the user data, or null if there is nothing to drop
+    static constexpr void (*drop)(void *) = is_inline
+            ? nullptr
+            : static_cast<void (*)(void *)>(
+                    [](void *user_data) { delete reinterpret_cast<F *>(user_data); });
+
+    /// Calls \a fn with the closure stored in \a user_data
+    template<typename Fn>
+    static decltype(auto) visit(void *user_data, Fn &&fn)
+    {
+        if constexpr (is_inline) {
+            alignas(F) unsigned char storage[sizeof(F)];
+            std::memcpy(storage, &user_data, sizeof(F));
+            return fn(*std::launder(reinterpret_cast<const F *>(storage)));
+        } else {
+            return fn(*reinterpret_cast<F *>(user_data));
+        }
+    }
+};
+
+} // namespace slint::private_api
@@ -5,12 +5,118 @@
 #include <string_view>
 #include "slint_generated_public.h"
 #include "slint_size.h"
-#include "slint_image_internal.h"
 #include "slint_string.h"
 #include "slint_sharedvector.h"
+#include "slint_image_internal.h"
 
 namespace slint {
 
+/// A pixel with three color channels (red, green and blue), each encoded as uint8_t.
+using Rgb8Pixel = cbindgen_private::types::Rgb8Pixel;
+/// A pixel with four color channels (red, green, blue and alpha), each encoded as uint8_t.
+using Rgba8Pixel = cbindgen_private::types::Rgba8Pixel;
+/// Tells whether the first row of a texture displayed with
+/// Image::create_from_borrowed_gl_2d_rgba_texture() is the top (`TopLeft`) or the bottom
+/// (`BottomLeft`) of the image. Textures rendered into with OpenGL are usually `BottomLeft`.
+using BorrowedOpenGLTextureOrigin = cbindgen_private::types::BorrowedOpenGLTextureOrigin;
+
+/// SharedPixelBuffer is a container for storing image data as pixels. It is internally reference
+/// counted and cheap to copy.
+///
+/// Create an Image from it to display the pixels. The Image refers to the same pixel data, no
+/// copy is made. Writing to the pixels through a non-const SharedPixelBuffer makes a copy first
+/// if the data is still shared, for example with an Image that is still set on a property.
+///
+/// To display frames from a camera or a video without allocating nor copying, use two buffers
+/// and alternate between them: always write the next frame in the buffer that is not currently
+/// displayed, then set a new Image created from it. Only the property holding the image is
+/// marked dirty, and the FemtoVG renderer uploads a frame of the same size and pixel format as
+/// the previous one into the existing texture:
+///
+/// ```
+/// slint::SharedPixelBuffer<slint::Rgb8Pixel> frames[2] = { { width, height }, { width, height } };
+/// int back = 0;
+/// void on_frame(const uint8_t *frame_data) {
+///     std::memcpy(frames[back].begin(), frame_data, frames[back].size() * 3);
+///     ui->set_video_frame(slint::Image(frames[back]));
+///     back = 1 - back;
+/// }
+/// ```
+template<typename Pixel>
+struct SharedPixelBuffer
+{
+    /// Construct an empty SharedPixelBuffer.
+    SharedPixelBuffer() = default;
+
+    /// Construct a SharedPixelBuffer with the given \a width and \a height. The pixels are
+    /// default-initialized.
+    SharedPixelBuffer(uint32_t width, uint32_t height)
+        : m_width(width), m_height(height), m_data(std::size_t(width) * height)
+    {
+    }
+
+    /// Construct a SharedPixelBuffer by copying the pixels of \a data, which must contain
+    /// \a width * \a height pixels.
+    SharedPixelBuffer(uint32_t width, uint32_t height, const Pixel *data)
+        : m_width(width), m_height(height), m_data(data, data + std::size_t(width) * height)
+    {
+    }
+
+    /// Construct a SharedPixelBuffer that refers to the pixels in \a data without copying them.
+    /// \a data should contain \a width * \a height pixels. If it contains less, it is extended
+    /// with default-initialized pixels, which copies it if it is shared.
+    SharedPixelBuffer(uint32_t width, uint32_t height, SharedVector<Pixel> data)
+        : m_width(width), m_height(height), m_data(std::move(data))
+    {
+        if (m_data.size() < std::size_t(width) * height) {
+            m_data.resize(std::size_t(width) * height);
+        }
+    }
+
+    /// Returns the width of the buffer in pixels.
+    uint32_t width() const { return m_width; }
+    /// Returns the height of the buffer in pixels.
+    uint32_t height() const { return m_height; }
+    /// Returns the number of pixels in the buffer.
+    std::size_t size() const { return m_data.size(); }
+
+    /// Returns a const pointer to the first pixel of this buffer.
+    const Pixel *begin() const { return m_data.begin(); }
+    /// Returns a const pointer past this buffer.
+    const Pixel *end() const { return m_data.end(); }
+    /// Returns a pointer to the first pixel of this buffer. The data is copied first if it is
+    /// shared with another buffer or image.
+    Pixel *begin() { return m_data.begin(); }
+    /// Returns a pointer past this buffer.
+    Pixel *end() { return m_data.end(); }
+
+    /// Returns a reference to the vector holding the pixels.
+    const SharedVector<Pixel> &data() const { return m_data; }
+
+    /// Returns true if \a a refers to the same pixel data as \a b; false otherwise.
+    friend bool operator==(const SharedPixelBuffer &a, const SharedPixelBuffer &b)
+    {
+        return a.m_width == b.m_width && a.m_height == b.m_height
+                && a.m_data.cbegin() == b.m_data.cbegin();
+    }
+    /// Returns false if \a a refers to the same pixel data as \a b; true otherwise.
+    friend bool operator!=(const SharedPixelBuffer &a, const SharedPixelBuffer &b)
+    {
+        return !(a == b);
+    }
+
+private:
+    friend struct Image;
+    cbindgen_private::types::SharedPixelBuffer<Pixel> into_inner() &&
+    {
+        return { m_width, m_height, m_width, std::move(m_data) };
+    }
+
+    uint32_t m_width = 0;
+    uint32_t m_height = 0;
+    SharedVector<Pixel> m_data;
+};
+
 /// An image type that can be displayed by the Image element
 struct Image
 {
@@ -25,13 +131,73 @@ public:
         return img;
     }
 
-    /*
-    static Image load_from_argb(int width, int height, const SharedVector<uint32_t> &data) {
+    /// Decodes the image file at \a file_path. If \a max_size is not empty and the image is
+    /// larger, it is downscaled after decoding to fit in \a max_size, preserving its aspect ratio,
+    /// so that thumbnails don't keep the full resolution pixels in memory once decoded.
+    ///
+    /// Unlike load_from_path(), this function can be called from any thread. Decoded images are
+    /// kept in a process-wide cache keyed on the path and \a max_size, see
+    /// set_decoded_image_cache_budget(). SVG files can't be decoded with this function.
+    ///
+    /// See also load_image_from_path_async().
+    static Image decode_from_path(const SharedString &file_path, Size<uint32_t> max_size = {})
+    {
         Image img;
-        img.data = Data::EmbeddedRgbaImage(width, height, data);
+        cbindgen_private::types::slint_image_decode_from_path(&file_path, max_size.width,
+                                                              max_size.height, &img.data);
         return img;
     }
-    */
+
+    /// Construct an image that displays the RGB pixels of \a buffer, without copying them.
+    explicit Image(SharedPixelBuffer<Rgb8Pixel> buffer)
+        : data(Data::ImageInner_EmbeddedImage(
+                cbindgen_private::types::ImageCacheKey::Invalid(),
+                cbindgen_private::types::SharedImageBuffer::RGB8(std::move(buffer).into_inner())))
+    {
+    }
+
+    /// Construct an image that displays the RGBA pixels of \a buffer, without copying them.
+    explicit Image(SharedPixelBuffer<Rgba8Pixel> buffer)
+        : data(Data::ImageInner_EmbeddedImage(
+                cbindgen_private::types::ImageCacheKey::Invalid(),
+                cbindgen_private::types::SharedImageBuffer::RGBA8(std::move(buffer).into_inner())))
+    {
+    }
+
+    /// Construct an image that displays the RGBA pixels of \a buffer, without copying them.
+    /// In contrast to the constructor taking a SharedPixelBuffer<Rgba8Pixel>, the alpha channel
+    /// is assumed to be already multiplied to the red, green and blue channels. This is more
+    /// efficient to render.
+    static Image create_from_premultiplied_rgba8(SharedPixelBuffer<Rgba8Pixel> buffer)
+    {
+        return Image(Data::ImageInner_EmbeddedImage(
+                cbindgen_private::types::ImageCacheKey::Invalid(),
+                cbindgen_private::types::SharedImageBuffer::RGBA8Premultiplied(
+                        std::move(buffer).into_inner())));
+    }
+
+    /// Construct an image that displays the existing OpenGL texture \a texture_id, without
+    /// copying its pixels to the CPU. The texture must be a `GL_TEXTURE_2D` texture of \a size
+    /// pixels with an RGBA format. A \a texture_id of 0 is not a texture: an empty image is
+    /// returned then. It must belong to the OpenGL context of the window, or
+    /// to a context sharing its textures, and stay valid with the same size as long as the image
+    /// or a copy of it exists.
+    ///
+    /// The texture is read each time a frame is rendered: after changing its contents, call
+    /// Window::request_redraw() to display them.
+    ///
+    /// Only the FemtoVG renderer displays these images. It copies the texture to the window on
+    /// the GPU, replacing the pixels below instead of blending with them, so the image is not
+    /// drawn when it has an opacity, is in a clip with a border radius or in a layer.
+    static Image create_from_borrowed_gl_2d_rgba_texture(uint32_t texture_id, Size<uint32_t> size,
+                                                         BorrowedOpenGLTextureOrigin origin)
+    {
+        if (texture_id == 0) {
+            return Image();
+        }
+        return Image(Data::ImageInner_BorrowedOpenGLTexture(
+                cbindgen_private::types::BorrowedOpenGLTexture { texture_id, size, origin }));
+    }
 
     /// Returns the size of the Image in pixels.
     Size<unsigned int> size() const { return cbindgen_private::types::slint_image_size(&data); }
@@ -60,6 +226,14 @@ private:
     Data data;
 };
 
+/// Sets the number of bytes of pixel data that the process-wide cache of images decoded with
+/// Image::decode_from_path() may hold. The least recently used images are evicted to stay
+/// within this budget, which defaults to 32 MiB. A budget of 0 disables the cache.
+inline void set_decoded_image_cache_budget(std::size_t bytes)
+{
+    cbindgen_private::types::slint_image_set_decoded_cache_budget(bytes);
+}
+
 namespace private_api {
 inline Image load_image_from_embedded_data(std::span<const uint8_t> data,
                                            std::string_view extension)
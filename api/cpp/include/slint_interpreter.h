@@ -332,6 +332,15 @@ public:
     /// The vector will be constructed by serializing all the elements of the model.
     inline std::optional<slint::SharedVector<Value>> to_array() const;
 
+    /// Returns a std::optional that contains a vector of numbers if the type of this Value is
+    /// Type::Model and all the rows of the model are numbers, otherwise an empty optional is
+    /// returned. \a T is `double`, `float` or `int32_t`.
+    ///
+    /// If the value was constructed from a SharedVector of the same type, the returned vector
+    /// shares its buffer. Otherwise the numbers are converted to \a T.
+    template<typename T>
+    std::optional<slint::SharedVector<T>> to_number_array() const;
+
     /// Returns a std::optional that contains a brush if the type of this Value is
     /// Type::Brush, otherwise an empty optional is returned.
     std::optional<slint::Brush> to_brush() const
@@ -383,6 +392,39 @@ public:
     inline Value(const SharedVector<Value> &v);
     /// Constructs a new Value that holds the value model \a m.
     Value(const std::shared_ptr<slint::Model<Value>> &m);
+    /// Constructs a new Value that holds a model of the numbers of \a numbers, which shares
+    /// its buffer. The rows of the model are numbers, but the array is stored in one
+    /// contiguous buffer instead of one Value per element.
+    Value(const SharedVector<double> &numbers)
+    {
+        cbindgen_private::slint_interpreter_value_new_number_array_f64(&numbers, &inner);
+    }
+    /// \overload
+    Value(const SharedVector<float> &numbers)
+    {
+        cbindgen_private::slint_interpreter_value_new_number_array_f32(&numbers, &inner);
+    }
+    /// \overload
+    Value(const SharedVector<int32_t> &numbers)
+    {
+        cbindgen_private::slint_interpreter_value_new_number_array_i32(&numbers, &inner);
+    }
+    /// Constructs a new Value that holds a model of a copy of \a numbers.
+    /// See Value(const SharedVector<double> &).
+    Value(std::span<const double> numbers)
+        : Value(SharedVector<double>(numbers.begin(), numbers.end()))
+    {
+    }
+    /// \overload
+    Value(std::span<const float> numbers)
+        : Value(SharedVector<float>(numbers.begin(), numbers.end()))
+    {
+    }
+    /// \overload
+    Value(std::span<const int32_t> numbers)
+        : Value(SharedVector<int32_t>(numbers.begin(), numbers.end()))
+    {
+    }
     /// Constructs a new Value that holds the brush \a b.
     Value(const slint::Brush &brush)
     {
@@ -432,6 +474,27 @@ inline std::optional<slint::SharedVector<Value>> Value::to_array() const
         return {};
     }
 }
+template<typename T>
+std::optional<slint::SharedVector<T>> Value::to_number_array() const
+{
+    slint::SharedVector<T> array;
+    bool ok;
+    if constexpr (std::is_same_v<T, double>) {
+        ok = cbindgen_private::slint_interpreter_value_to_number_array_f64(&inner, &array);
+    } else if constexpr (std::is_same_v<T, float>) {
+        ok = cbindgen_private::slint_interpreter_value_to_number_array_f32(&inner, &array);
+    } else {
+        static_assert(std::is_same_v<T, int32_t>,
+                      "to_number_array() supports double, float and int32_t");
+        ok = cbindgen_private::slint_interpreter_value_to_number_array_i32(&inner, &array);
+    }
+    if (ok) {
+        return array;
+    } else {
+        return {};
+    }
+}
+
 inline Value::Value(const std::shared_ptr<slint::Model<Value>> &model)
 {
     using cbindgen_private::ModelAdaptorVTable;
@@ -453,6 +516,10 @@ inline Value::Value(const std::shared_ptr<slint::Model<Value>> &model)
         {
             cbindgen_private::slint_interpreter_model_notify_row_changed(&notify, index);
         }
+        void rows_changed(int index, int count) override
+        {
+            cbindgen_private::slint_interpreter_model_notify_rows_changed(&notify, index, count);
+        }
         void row_removed(int index, int count) override
         {
             cbindgen_private::slint_interpreter_model_notify_row_removed(&notify, index, count);
@@ -522,6 +589,78 @@ inline void Struct::set_field(std::string_view name, const Value &value)
     cbindgen_private::slint_interpreter_struct_set_field(&inner, name_view, &value.inner);
 }
 
+namespace private_api {
+/// Shared ownership of a property or callback name resolved by the interpreter
+struct ResolvedName
+{
+    explicit ResolvedName(cbindgen_private::ResolvedName *resolved)
+        : inner(resolved, cbindgen_private::slint_interpreter_resolved_name_destructor)
+    {
+    }
+    std::shared_ptr<cbindgen_private::ResolvedName> inner;
+};
+}
+
+/// A PropertyHandle refers to a public property of a ComponentDefinition. It can be obtained
+/// once with ComponentDefinition::property_handle() and then be used to read and write the
+/// property of all the instances of that definition with ComponentInstance::get_property() and
+/// ComponentInstance::set_property(), without looking up the property by its name for each call.
+class PropertyHandle
+{
+    friend class ComponentDefinition;
+    friend class ComponentInstance;
+    friend class PropertyUpdate;
+
+    PropertyHandle(cbindgen_private::ResolvedName *resolved, Value::Type type)
+        : resolved(resolved), property_type(type)
+    {
+    }
+
+    private_api::ResolvedName resolved;
+    Value::Type property_type;
+
+public:
+    /// Returns the type of the property
+    Value::Type type() const { return property_type; }
+};
+
+/// A CallbackHandle refers to a public callback of a ComponentDefinition. It can be obtained
+/// once with ComponentDefinition::callback_handle() and then be used to invoke the callback of
+/// all the instances of that definition with ComponentInstance::invoke_callback(), without
+/// looking up the callback by its name for each call.
+class CallbackHandle
+{
+    friend class ComponentDefinition;
+    friend class ComponentInstance;
+
+    explicit CallbackHandle(cbindgen_private::ResolvedName *resolved) : resolved(resolved) { }
+
+    private_api::ResolvedName resolved;
+};
+
+/// A PropertyUpdate is the new value for a property, used to set several properties at once with
+/// ComponentInstance::set_properties() or ComponentInstance::set_global_properties().
+class PropertyUpdate
+{
+    friend class ComponentInstance;
+
+    std::string_view name;
+    const cbindgen_private::ResolvedName *resolved = nullptr;
+    Value value;
+
+public:
+    /// Constructs an update that sets the property called \a name to \a value. The string
+    /// the \a name refers to must stay valid until the update was applied.
+    PropertyUpdate(std::string_view name, Value value) : name(name), value(std::move(value)) { }
+    /// Constructs an update that sets the property referred to by the \a property handle to
+    /// \a value. The handle must stay valid until the update was applied. Handles are not
+    /// supported by ComponentInstance::set_global_properties().
+    PropertyUpdate(const PropertyHandle &property, Value value)
+        : resolved(property.resolved.inner.get()), value(std::move(value))
+    {
+    }
+};
+
 /// The ComponentInstance represents a running instance of a component.
 ///
 /// You can create an instance with the ComponentDefinition::create() function.
@@ -544,6 +683,18 @@ class ComponentInstance : vtable::Dyn
         return reinterpret_cast<const cbindgen_private::ErasedComponentBox *>(this);
     }
 
+    static std::vector<cbindgen_private::PropertyValueUpdate>
+    to_ffi_updates(std::span<const PropertyUpdate> updates)
+    {
+        std::vector<cbindgen_private::PropertyValueUpdate> ffi_updates;
+        ffi_updates.reserve(updates.size());
+        for (const auto &update : updates) {
+            ffi_updates.push_back({ slint::private_api::string_to_slice(update.name),
+                                    update.resolved, &update.value.inner });
+        }
+        return ffi_updates;
+    }
+
 public:
     /// Marks the window of this component to be shown on the screen. This registers
     /// the window with the windowing system. In order to react to events from the windowing system,
@@ -619,6 +770,29 @@ public:
             return {};
         }
     }
+    /// Same as set_property(std::string_view, const Value &), but for a property that was
+    /// resolved with ComponentDefinition::property_handle(). Returns false if the \a property
+    /// does not belong to the definition of this instance, or if the value does not have the
+    /// proper type.
+    bool set_property(const PropertyHandle &property, const Value &value) const
+    {
+        using namespace cbindgen_private;
+        return slint_interpreter_component_instance_set_resolved_property(
+                inner(), property.resolved.inner.get(), &value.inner);
+    }
+    /// Same as get_property(std::string_view), but for a property that was resolved with
+    /// ComponentDefinition::property_handle()
+    std::optional<Value> get_property(const PropertyHandle &property) const
+    {
+        using namespace cbindgen_private;
+        ValueOpaque out;
+        if (slint_interpreter_component_instance_get_resolved_property(
+                    inner(), property.resolved.inner.get(), &out)) {
+            return Value(out);
+        } else {
+            return {};
+        }
+    }
     /// Invoke the specified callback declared in .slint with the given arguments
     ///
     /// Example: imagine the .slint file contains the given callback declaration:
@@ -648,6 +822,47 @@ public:
             return {};
         }
     }
+    /// Sets the values of several properties with a single call into the Slint run-time.
+    ///
+    /// Example:
+    /// ```
+    ///     slint::interpreter::PropertyUpdate updates[] = { { "temperature", 21.5 },
+    ///                                                      { "status", SharedString("ok") } };
+    ///     instance->set_properties(updates);
+    /// ```
+    ///
+    /// The properties are set in the given order. Setting a property only marks the bindings
+    /// that depend on it as dirty, so they are evaluated once, when needed, and the window
+    /// is redrawn once for all the changes.
+    ///
+    /// Returns true if all the properties were set. Returns false if any of the properties
+    /// could not be set, for the same reasons as set_property(). The other properties are still
+    /// set.
+    bool set_properties(std::span<const PropertyUpdate> updates) const
+    {
+        using namespace cbindgen_private;
+        auto ffi_updates = to_ffi_updates(updates);
+        return slint_interpreter_component_instance_set_properties(
+                inner(), { ffi_updates.data(), ffi_updates.size() });
+    }
+
+    /// Same as invoke_callback(std::string_view, std::span<const Value>), but for a callback
+    /// that was resolved with ComponentDefinition::callback_handle()
+    std::optional<Value> invoke_callback(const CallbackHandle &callback,
+                                         std::span<const Value> args) const
+    {
+        using namespace cbindgen_private;
+        Slice<ValueOpaque> args_view { const_cast<ValueOpaque *>(
+                                               reinterpret_cast<const ValueOpaque *>(args.data())),
+                                       args.size() };
+        ValueOpaque out;
+        if (slint_interpreter_component_instance_invoke_resolved_callback(
+                    inner(), callback.resolved.inner.get(), args_view, &out)) {
+            return Value(out);
+        } else {
+            return {};
+        }
+    }
 
     /// Set a handler for the callback with the given name.
     ///
@@ -707,6 +922,21 @@ public:
                 inner(), slint::private_api::string_to_slice(global),
                 slint::private_api::string_to_slice(prop_name), &value.inner);
     }
+    /// Sets the values of several properties within an exported global singleton with a single
+    /// call into the Slint run-time. See set_properties(). The updates must refer to the
+    /// properties by name.
+    ///
+    /// Returns true if all the properties were set. Returns false if the global does not exist,
+    /// or if any of the properties could not be set. The other properties are still set.
+    bool set_global_properties(std::string_view global,
+                               std::span<const PropertyUpdate> updates) const
+    {
+        using namespace cbindgen_private;
+        auto ffi_updates = to_ffi_updates(updates);
+        return slint_interpreter_component_instance_set_global_properties(
+                inner(), slint::private_api::string_to_slice(global),
+                { ffi_updates.data(), ffi_updates.size() });
+    }
     /// Returns the value behind a property in an exported global singleton.
     std::optional<Value> get_global_property(std::string_view global,
                                              std::string_view prop_name) const
@@ -840,6 +1070,32 @@ public:
         return props;
     }
 
+    /// Resolves the public property with the given \a name, for faster repeated accesses with
+    /// ComponentInstance::get_property() and ComponentInstance::set_property() on the instances
+    /// of this definition. Returns an empty optional if there is no such property.
+    std::optional<PropertyHandle> property_handle(std::string_view name) const
+    {
+        Value::Type type = Value::Type::Void;
+        if (auto resolved = cbindgen_private::slint_interpreter_component_definition_resolve_name(
+                    &inner, slint::private_api::string_to_slice(name), false, &type)) {
+            return PropertyHandle(resolved, type);
+        }
+        return {};
+    }
+
+    /// Resolves the public callback with the given \a name, for faster repeated invocations
+    /// with ComponentInstance::invoke_callback() on the instances of this definition. Returns an
+    /// empty optional if there is no such callback.
+    std::optional<CallbackHandle> callback_handle(std::string_view name) const
+    {
+        Value::Type type = Value::Type::Void;
+        if (auto resolved = cbindgen_private::slint_interpreter_component_definition_resolve_name(
+                    &inner, slint::private_api::string_to_slice(name), true, &type)) {
+            return CallbackHandle(resolved);
+        }
+        return {};
+    }
+
     /// Returns a vector of strings that describe the list of public callbacks that can be invoked
     /// using ComponentInstance::invoke_callback and set using ComponentInstance::set_callback.
     slint::SharedVector<slint::SharedString> callbacks() const
@@ -3,6 +3,7 @@
 
 #pragma once
 #include <initializer_list>
+#include <span>
 #include <string_view>
 #include "slint_pathdata_internal.h"
 
@@ -33,11 +34,41 @@ public:
     {
     }
 
+    /// Adopts the \a events and \a coordinates without copying them
+    PathData(SharedVector<PathEvent> events, SharedVector<Point> coordinates)
+        : data(Data::Events(std::move(events), std::move(coordinates)))
+    {
+    }
+
     PathData(const SharedString &commands)
         : data(cbindgen_private::types::PathData::Commands(commands))
     {
     }
 
+    /// Appends lines through \a points. If the path ends with a sub-path that remains open,
+    /// the lines continue it, otherwise they start a new sub-path at the first point.
+    /// The events and coordinates are extended in place: they are only copied if they are shared
+    /// with another PathData.
+    void append_polyline(std::span<const Point> points)
+    {
+        cbindgen_private::types::slint_path_data_append_polyline(&data, points.data(),
+                                                                 points.size());
+    }
+
+    /// Returns a path with lines through the \a points of a polyline sorted by x, reduced to at
+    /// most four points for each of the \a columns columns that divide the range from \a min_x
+    /// to \a max_x: the first, the lowest, the highest and the last point of the column.
+    /// Passing the width of the path in pixels as \a columns keeps the look of the polyline,
+    /// while the cost of rendering depends on the width instead of the number of points.
+    static PathData decimated_polyline(std::span<const Point> points, float min_x, float max_x,
+                                       size_t columns)
+    {
+        PathData result;
+        cbindgen_private::types::slint_path_data_decimated_polyline(
+                &result.data, points.data(), points.size(), min_x, max_x, columns);
+        return result;
+    }
+
     friend bool operator==(const PathData &a, const PathData &b) = default;
 
 private:
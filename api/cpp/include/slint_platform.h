@@ -0,0 +1,376 @@
+// Copyright © SixtyFPS GmbH <info@slint-ui.com>
+// SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-Slint-commercial
+
+#pragma once
+
+#include "slint.h"
+#include <utility>
+
+/// Use the types in this namespace to run Slint on a platform that is not supported by one of
+/// the built-in backends, for example a micro-controller or an embedded display without a
+/// windowing system. Implement a Platform, create a SoftwareWindow from
+/// Platform::create_window_adapter(), and call SoftwareWindow::draw_if_needed() from your event
+/// loop to render into your frame buffer.
+namespace slint::platform {
+
+using cbindgen_private::PointerEventButton;
+
+/// A 16bit pixel that has 5 red bits, 6 green bits and 5 blue bits, as used by many embedded
+/// displays.
+struct Rgb565Pixel
+{
+    /// The red, green and blue components, packed from the most significant bit
+    uint16_t rgb = 0;
+
+    /// Compares two pixels for equality
+    friend bool operator==(const Rgb565Pixel &a, const Rgb565Pixel &b) = default;
+};
+static_assert(sizeof(Rgb565Pixel) == sizeof(uint16_t));
+
+/// The region of the buffer that was redrawn by SoftwareRenderer::render(), in physical pixels
+struct RenderedRegion
+{
+    /// The top left corner of the region
+    PhysicalPosition origin;
+    /// The size of the region
+    Size<int32_t> size = { 0, 0 };
+};
+
+/// The renderer passed to the callback of SoftwareWindow::draw_if_needed(). It renders the
+/// window's scene into a buffer provided by the platform, and is only valid during that
+/// callback.
+class SoftwareRenderer
+{
+public:
+    /// Renders into `buffer`, in which a line is `pixel_stride` pixels apart from the next one.
+    /// Only the parts that changed since the buffer was last rendered into are redrawn. Returns
+    /// the region that was redrawn, which is the only part that needs to be sent to the screen.
+    RenderedRegion render(std::span<Rgb565Pixel> buffer, std::size_t pixel_stride) const
+    {
+        return make_region(cbindgen_private::slint_software_renderer_render_rgb565(
+                inner, &buffer.data()->rgb, buffer.size(), pixel_stride));
+    }
+
+    /// \overload
+    RenderedRegion render(std::span<Rgb8Pixel> buffer, std::size_t pixel_stride) const
+    {
+        return make_region(cbindgen_private::slint_software_renderer_render_rgb8(
+                inner, reinterpret_cast<uint8_t *>(buffer.data()), buffer.size(), pixel_stride));
+    }
+
+    /// Renders line by line, for platforms that don't have the memory for a full frame buffer.
+    ///
+    /// For each line that needs to be redrawn, `process_line` is called with the line number,
+    /// the begin and end of the range of pixels within that line to redraw, and a function
+    /// that renders into a `std::span<Rgb565Pixel>` of `end - begin` pixels. `process_line`
+    /// must call that function once, and then send the pixels to the screen:
+    /// ```cpp
+    /// std::array<slint::platform::Rgb565Pixel, 320> line_buffer;
+    /// renderer.render_by_line([&](std::size_t line, std::size_t begin, std::size_t end,
+    ///                             auto render_fn) {
+    ///     std::span<slint::platform::Rgb565Pixel> range(line_buffer.data() + begin, end - begin);
+    ///     render_fn(range);
+    ///     display.send_line(line, begin, range);
+    /// });
+    /// ```
+    template<typename ProcessLine>
+    void render_by_line(ProcessLine process_line) const
+    {
+        cbindgen_private::slint_software_renderer_render_by_line_rgb565(
+                inner, &process_line,
+                [](void *process_line, uintptr_t line, uintptr_t begin, uintptr_t end,
+                   void (*render_fn)(void *, uint16_t *, uintptr_t), void *render_data) {
+                    (*reinterpret_cast<ProcessLine *>(process_line))(
+                            std::size_t(line), std::size_t(begin), std::size_t(end),
+                            [render_fn, render_data](std::span<Rgb565Pixel> buffer) {
+                                render_fn(render_data, &buffer.data()->rgb, buffer.size());
+                            });
+                });
+    }
+
+private:
+    friend class SoftwareWindow;
+    explicit SoftwareRenderer(const void *inner) : inner(inner) { }
+
+    static RenderedRegion make_region(cbindgen_private::PlatformRenderedRegion r)
+    {
+        return { PhysicalPosition({ r.x, r.y }), { r.width, r.height } };
+    }
+
+    const void *inner;
+};
+
+/// A window that is rendered with the software renderer, to be returned from
+/// Platform::create_window_adapter(). The platform forwards input events to it, and renders it
+/// from its event loop with draw_if_needed().
+class SoftwareWindow
+{
+public:
+    /// Describes what the buffer passed to SoftwareRenderer::render() contains, which lets the
+    /// renderer only redraw what changed.
+    enum class RepaintBufferType : uint32_t {
+        /// The buffer is a new buffer every frame: everything is redrawn.
+        NewBuffer = 0,
+        /// The same buffer is passed every frame and still holds the previous frame.
+        ReusedBuffer = 1,
+        /// Two buffers are swapped: the buffer holds the frame before the previous one.
+        SwappedBuffers = 2,
+    };
+
+    /// Creates a new window for the given kind of buffer
+    explicit SoftwareWindow(RepaintBufferType buffer_type = RepaintBufferType::ReusedBuffer)
+        : inner(cbindgen_private::slint_software_window_new(uint32_t(buffer_type)))
+    {
+    }
+    ~SoftwareWindow() { cbindgen_private::slint_software_window_drop(inner); }
+    SoftwareWindow(const SoftwareWindow &) = delete;
+    SoftwareWindow &operator=(const SoftwareWindow &) = delete;
+
+    /// Sets the size of the window, in physical pixels. Call this before the window is shown
+    /// and whenever the size of the screen changes.
+    void set_size(const PhysicalSize &size)
+    {
+        cbindgen_private::slint_software_window_set_size(inner, size.width, size.height);
+    }
+
+    /// Dispatches a press of `button` at the logical position `pos`
+    void dispatch_pointer_press_event(LogicalPosition pos, PointerEventButton button)
+    {
+        dispatch_pointer_event(cbindgen_private::PlatformPointerEventKind::Pressed, pos, button);
+    }
+    /// Dispatches a release of `button` at the logical position `pos`
+    void dispatch_pointer_release_event(LogicalPosition pos, PointerEventButton button)
+    {
+        dispatch_pointer_event(cbindgen_private::PlatformPointerEventKind::Released, pos, button);
+    }
+    /// Dispatches a move of the pointer to the logical position `pos`
+    void dispatch_pointer_move_event(LogicalPosition pos)
+    {
+        dispatch_pointer_event(cbindgen_private::PlatformPointerEventKind::Moved, pos);
+    }
+    /// Dispatches a scroll by `delta_x` and `delta_y` logical pixels at the position `pos`
+    void dispatch_pointer_scroll_event(LogicalPosition pos, float delta_x, float delta_y)
+    {
+        dispatch_pointer_event(cbindgen_private::PlatformPointerEventKind::Scrolled, pos,
+                               PointerEventButton::None, delta_x, delta_y);
+    }
+    /// Dispatches that the pointer left the window
+    void dispatch_pointer_exit_event()
+    {
+        dispatch_pointer_event(cbindgen_private::PlatformPointerEventKind::Exited, {});
+    }
+
+    /// Returns true if there are animations running, in which case the platform should call
+    /// draw_if_needed() again for the next frame without waiting for an event.
+    bool has_active_animations() const
+    {
+        return cbindgen_private::slint_software_window_has_active_animations(inner);
+    }
+
+    /// If the window needs to be redrawn, calls `render_callback` with the SoftwareRenderer
+    /// to render it, and returns true. Returns false if nothing changed.
+    template<std::invocable<const SoftwareRenderer &> F>
+    bool draw_if_needed(F render_callback)
+    {
+        return cbindgen_private::slint_software_window_draw_if_needed(
+                inner, &render_callback, [](void *render_callback, const void *renderer) {
+                    (*reinterpret_cast<F *>(render_callback))(SoftwareRenderer(renderer));
+                });
+    }
+
+private:
+    friend class Platform;
+
+    void dispatch_pointer_event(cbindgen_private::PlatformPointerEventKind kind,
+                                LogicalPosition pos,
+                                PointerEventButton button = PointerEventButton::None,
+                                float delta_x = 0, float delta_y = 0)
+    {
+        cbindgen_private::slint_software_window_dispatch_pointer_event(
+                inner, kind, pos.x, pos.y, button, delta_x, delta_y);
+    }
+
+    cbindgen_private::SoftwareWindowOpaque inner;
+};
+
+/// Implement this interface and pass it to Platform::set_platform() before creating any
+/// component, to run Slint on a custom platform.
+class Platform
+{
+public:
+    /// A functor passed to invoke_from_event_loop(), to be run from the event loop thread.
+    /// If it is destroyed without being run, its resources are released.
+    class Task
+    {
+    public:
+        Task(Task &&other) : inner(std::exchange(other.inner, { nullptr })) { }
+        Task &operator=(Task &&other)
+        {
+            std::swap(inner, other.inner);
+            return *this;
+        }
+        ~Task()
+        {
+            if (inner._0)
+                cbindgen_private::slint_platform_task_drop(inner);
+        }
+
+        /// Runs the task. Must be called from the event loop thread, at most once.
+        void run() &&
+        {
+            cbindgen_private::slint_platform_task_run(std::exchange(inner, { nullptr }));
+        }
+
+    private:
+        friend class Platform;
+        explicit Task(cbindgen_private::PlatformTaskOpaque inner) : inner(inner) { }
+        cbindgen_private::PlatformTaskOpaque inner;
+    };
+
+    virtual ~Platform() = default;
+    Platform(const Platform &) = delete;
+    Platform &operator=(const Platform &) = delete;
+    Platform() = default;
+
+    /// Returns the window in which a new component is shown. The platform can keep a copy
+    /// to render it and forward events to it.
+    virtual std::shared_ptr<SoftwareWindow> create_window_adapter() = 0;
+
+    /// Runs the event loop until quit_event_loop() is called. Call
+    /// update_timers_and_animations() and SoftwareWindow::draw_if_needed() from it, and run the
+    /// tasks passed to invoke_from_event_loop().
+    virtual void run_event_loop() { }
+
+    /// Makes run_event_loop() return. Can be called from any thread.
+    virtual void quit_event_loop() { }
+
+    /// Queues `task` to be run from the event loop thread, and wakes up the event loop. Can be
+    /// called from any thread.
+    virtual void invoke_from_event_loop(Task task) { (void)task; }
+
+    /// Returns the time elapsed since an arbitrary point in time, used to drive timers and
+    /// animations. The default implementation uses std::chrono::steady_clock.
+    virtual std::chrono::milliseconds duration_since_start()
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start_time);
+    }
+
+    /// Registers `platform` as the platform used by Slint on the calling thread, which runs the
+    /// main event loop that slint::invoke_from_event_loop() targets. Call this once from the main
+    /// thread, before any component is created. Returns false if a platform was already set on
+    /// this thread, or if another thread runs the main event loop already.
+    ///
+    /// Other threads register a platform of their own with set_thread_platform().
+    static bool set_platform(std::unique_ptr<Platform> platform)
+    {
+        return register_platform(std::move(platform), true);
+    }
+
+    /// Registers `platform` as the platform used by Slint on the calling thread, to run an event
+    /// loop independent from the main event loop, with its own windows, timers and components.
+    /// This must be called once, before any component is created on this thread. Returns false if
+    /// a platform was already set on this thread.
+    ///
+    /// slint::invoke_from_event_loop() still targets the main event loop. See EventLoopContext to
+    /// reach the event loop of this thread.
+    static bool set_thread_platform(std::unique_ptr<Platform> platform)
+    {
+        return register_platform(std::move(platform), false);
+    }
+
+private:
+    static bool register_platform(std::unique_ptr<Platform> platform, bool main)
+    {
+        bool registered = cbindgen_private::slint_platform_register(
+                platform.release(), [](void *p) { delete reinterpret_cast<Platform *>(p); },
+                [](void *p, cbindgen_private::WindowAdapterRcOpaque *out) {
+                    auto window = reinterpret_cast<Platform *>(p)->create_window_adapter();
+                    cbindgen_private::slint_software_window_adapter(window->inner, out);
+                },
+                [](void *p) { return reinterpret_cast<Platform *>(p)->run_event_loop(); },
+                [](void *p) { return reinterpret_cast<Platform *>(p)->quit_event_loop(); },
+                [](void *p, cbindgen_private::PlatformTaskOpaque task) {
+                    return reinterpret_cast<Platform *>(p)->invoke_from_event_loop(Task(task));
+                },
+                [](void *p) -> uint64_t {
+                    return reinterpret_cast<Platform *>(p)->duration_since_start().count();
+                },
+                main);
+        if (registered) {
+            private_api::is_event_loop_thread = true;
+        }
+        return registered;
+    }
+
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+};
+
+/// Implement this interface and pass it to Allocator::set_allocator() to provide the memory of
+/// every SharedVector and SharedString, for example from a pool of size classes that bounds the
+/// fragmentation of the heap and makes the allocation time predictable. Blocks can outlive a
+/// frame, so an allocator that serves temporary results from an arena must still be able to
+/// free blocks individually.
+///
+/// The functions can be called from any thread.
+class Allocator
+{
+public:
+    virtual ~Allocator() = default;
+    Allocator(const Allocator &) = delete;
+    Allocator &operator=(const Allocator &) = delete;
+    Allocator() = default;
+
+    /// Returns a block of \a size bytes aligned to \a align, or nullptr if there is no memory
+    /// left, in which case Slint aborts.
+    virtual void *allocate(std::size_t size, std::size_t align) = 0;
+
+    /// Frees a block returned by allocate() for the same \a size and \a align.
+    virtual void deallocate(void *ptr, std::size_t size, std::size_t align) = 0;
+
+    /// Registers \a allocator as the allocator of every SharedVector and SharedString. This must
+    /// be called before the first vector or string is allocated, so that each block is freed by
+    /// the allocator that allocated it. Returns false, and destroys \a allocator, if an
+    /// allocator was already set or a block was already allocated.
+    static bool set_allocator(std::unique_ptr<Allocator> allocator)
+    {
+        auto hooks = new cbindgen_private::SharedVectorAllocator {
+            allocator.get(),
+            [](void *allocator, uintptr_t size, uintptr_t align) {
+                return reinterpret_cast<uint8_t *>(
+                        reinterpret_cast<Allocator *>(allocator)->allocate(size, align));
+            },
+            [](void *allocator, uint8_t *ptr, uintptr_t size, uintptr_t align) {
+                reinterpret_cast<Allocator *>(allocator)->deallocate(ptr, size, align);
+            }
+        };
+        if (!cbindgen_private::slint_shared_vector_set_allocator(hooks)) {
+            delete hooks;
+            return false;
+        }
+        // Both are needed until the end of the process
+        allocator.release();
+        return true;
+    }
+};
+
+/// Updates the timers and animations. Call this from the event loop of the platform before
+/// rendering.
+inline void update_timers_and_animations()
+{
+    cbindgen_private::slint_platform_update_timers_and_animations();
+}
+
+/// Returns how long the event loop may wait for events before the next timer fires, or
+/// std::nullopt if there is no active timer.
+inline std::optional<std::chrono::milliseconds> duration_until_next_timer_update()
+{
+    uint64_t val = cbindgen_private::slint_platform_duration_until_next_timer_update();
+    if (val == std::numeric_limits<uint64_t>::max()) {
+        return std::nullopt;
+    } else {
+        return std::chrono::milliseconds(val);
+    }
+}
+
+}
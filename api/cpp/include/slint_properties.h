@@ -4,17 +4,33 @@
 #pragma once
 #include <string_view>
 #include <memory>
+#include <type_traits>
+#if defined(SLINT_FEATURE_BINDING_PROFILER)
+#    include <source_location>
+#endif
 
 namespace slint::cbindgen_private {
 struct PropertyAnimation;
 }
 
 #include "slint_properties_internal.h"
+#include "slint_closure.h"
 
 namespace slint::private_api {
 
 using cbindgen_private::StateInfo;
 
+#if defined(SLINT_FEATURE_BINDING_PROFILER)
+/// The location of the code that sets a binding, reported by the binding profiler
+using BindingLocation = std::source_location;
+#else
+/// Empty when the binding profiler is not compiled in
+struct BindingLocation
+{
+    static constexpr BindingLocation current() { return {}; }
+};
+#endif
+
 inline void slint_property_set_animated_binding_helper(
         const cbindgen_private::PropertyHandleOpaque *handle, void (*binding)(void *, int32_t *),
         void *user_data, void (*drop_user_data)(void *),
@@ -87,31 +103,43 @@ struct Property
         return value;
     }
 
+    /// The binding either returns the new value, or updates in place the value that it gets by
+    /// reference, which reuses its memory.
     template<typename F>
-    void set_binding(F binding) const
+    void set_binding(F binding, BindingLocation location = BindingLocation::current()) const
     {
+        constexpr bool in_place = !std::is_invocable_v<F &>;
+        using Storage = std::conditional_t<in_place, ClosureStorage<F, T &>, ClosureStorage<F>>;
         cbindgen_private::slint_property_set_binding(
                 &inner,
                 [](void *user_data, void *value) {
-                    *reinterpret_cast<T *>(value) = (*reinterpret_cast<F *>(user_data))();
+                    Storage::visit(user_data, [value](auto &f) {
+                        if constexpr (in_place) {
+                            f(*reinterpret_cast<T *>(value));
+                        } else {
+                            *reinterpret_cast<T *>(value) = f();
+                        }
+                    });
                 },
-                new F(binding), [](void *user_data) { delete reinterpret_cast<F *>(user_data); },
-                nullptr, nullptr);
+                Storage::create(std::move(binding)), Storage::drop, nullptr, nullptr);
+        set_binding_location(location);
     }
 
     inline void set_animated_value(const T &value,
                                    const cbindgen_private::PropertyAnimation &animation_data) const;
     template<typename F>
-    inline void
-    set_animated_binding(F binding, const cbindgen_private::PropertyAnimation &animation_data) const
+    inline void set_animated_binding(F binding,
+                                     const cbindgen_private::PropertyAnimation &animation_data,
+                                     BindingLocation location = BindingLocation::current()) const
     {
         private_api::slint_property_set_animated_binding_helper(
                 &inner,
                 [](void *user_data, T *value) {
-                    *reinterpret_cast<T *>(value) = (*reinterpret_cast<F *>(user_data))();
+                    *value = ClosureStorage<F>::visit(user_data, [](auto &f) { return f(); });
                 },
-                new F(binding), [](void *user_data) { delete reinterpret_cast<F *>(user_data); },
+                ClosureStorage<F>::create(std::move(binding)), ClosureStorage<F>::drop,
                 &animation_data, nullptr);
+        set_binding_location(location);
     }
 
     template<typename F, typename Trans>
@@ -145,31 +173,36 @@ struct Property
         if ((p2->inner._0 & 0b10) == 0b10) {
             std::swap(handle, const_cast<Property<T> *>(p2)->inner);
         }
-        auto common_property = std::make_shared<Property<T>>(handle, std::move(value));
+        // Both bindings share the common property, which is freed with the last of them
         struct TwoWayBinding
         {
-            std::shared_ptr<Property<T>> common_property;
+            Property<T> common_property;
+            unsigned int refcount;
+        };
+        auto shared = new TwoWayBinding { Property<T>(handle, std::move(value)), 2 };
+        auto del_fn = [](void *user_data) {
+            auto binding = reinterpret_cast<TwoWayBinding *>(user_data);
+            if (--binding->refcount == 0) {
+                delete binding;
+            }
         };
-        auto del_fn = [](void *user_data) { delete reinterpret_cast<TwoWayBinding *>(user_data); };
         auto call_fn = [](void *user_data, void *value) {
             *reinterpret_cast<T *>(value) =
-                    reinterpret_cast<TwoWayBinding *>(user_data)->common_property->get();
+                    reinterpret_cast<TwoWayBinding *>(user_data)->common_property.get();
         };
         auto intercept_fn = [](void *user_data, const void *value) {
-            reinterpret_cast<TwoWayBinding *>(user_data)->common_property->set(
+            reinterpret_cast<TwoWayBinding *>(user_data)->common_property.set(
                     *reinterpret_cast<const T *>(value));
             return true;
         };
         auto intercept_binding_fn = [](void *user_data, void *value) {
             cbindgen_private::slint_property_set_binding_internal(
-                    &reinterpret_cast<TwoWayBinding *>(user_data)->common_property->inner, value);
+                    &reinterpret_cast<TwoWayBinding *>(user_data)->common_property.inner, value);
             return true;
         };
-        cbindgen_private::slint_property_set_binding(&p1->inner, call_fn,
-                                                     new TwoWayBinding { common_property }, del_fn,
+        cbindgen_private::slint_property_set_binding(&p1->inner, call_fn, shared, del_fn,
                                                      intercept_fn, intercept_binding_fn);
-        cbindgen_private::slint_property_set_binding(&p2->inner, call_fn,
-                                                     new TwoWayBinding { common_property }, del_fn,
+        cbindgen_private::slint_property_set_binding(&p2->inner, call_fn, shared, del_fn,
                                                      intercept_fn, intercept_binding_fn);
     }
 
@@ -180,6 +213,14 @@ struct Property
     }
 
 private:
+    void set_binding_location([[maybe_unused]] const BindingLocation &location) const
+    {
+#if defined(SLINT_FEATURE_BINDING_PROFILER)
+        cbindgen_private::slint_property_set_binding_location(&inner, location.file_name(),
+                                                              location.line());
+#endif
+    }
+
     cbindgen_private::PropertyHandleOpaque inner;
     mutable T value {};
     template<typename F>
@@ -208,8 +249,10 @@ void set_state_binding(const Property<StateInfo> &property, F binding)
 {
     cbindgen_private::slint_property_set_state_binding(
             &property.inner,
-            [](void *user_data) -> int32_t { return (*reinterpret_cast<F *>(user_data))(); },
-            new F(binding), [](void *user_data) { delete reinterpret_cast<F *>(user_data); });
+            [](void *user_data) -> int32_t {
+                return ClosureStorage<F>::visit(user_data, [](auto &f) { return f(); });
+            },
+            ClosureStorage<F>::create(std::move(binding)), ClosureStorage<F>::drop);
 }
 
 /// PropertyTracker allows keeping track of when properties change and lazily evaluate code
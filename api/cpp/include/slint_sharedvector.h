@@ -6,6 +6,7 @@
 #include <atomic>
 #include <algorithm>
 #include <initializer_list>
+#include <iterator>
 
 namespace slint {
 
@@ -34,6 +35,41 @@ struct SharedVector
         *this = std::move(new_array);
     }
 
+    /// Creates a new vector of \a size default-constructed elements.
+    explicit SharedVector(std::size_t size) : SharedVector(size, T()) { }
+
+    /// Creates a new vector of \a size elements that are copies of \a value.
+    SharedVector(std::size_t size, const T &value) : SharedVector()
+    {
+        if (size == 0) {
+            return;
+        }
+        auto new_array = SharedVector::with_capacity(size);
+        auto new_data = reinterpret_cast<T *>(new_array.inner + 1);
+        for (std::size_t i = 0; i < size; ++i) {
+            new (new_data + i) T(value);
+            new_array.inner->size++;
+        }
+        *this = std::move(new_array);
+    }
+
+    /// Creates a new vector that holds copies of the elements in the range [\a first, \a last).
+    template<std::forward_iterator It>
+    SharedVector(It first, It last) : SharedVector()
+    {
+        auto size = std::size_t(std::distance(first, last));
+        if (size == 0) {
+            return;
+        }
+        auto new_array = SharedVector::with_capacity(size);
+        auto new_data = reinterpret_cast<T *>(new_array.inner + 1);
+        for (; first != last; ++first) {
+            new (new_data + new_array.inner->size) T(*first);
+            new_array.inner->size++;
+        }
+        *this = std::move(new_array);
+    }
+
     /// Creates a new vector that is a copy of \a other.
     SharedVector(const SharedVector &other) : inner(other.inner)
     {
@@ -107,18 +143,103 @@ struct SharedVector
     const T &at(std::size_t index) const { return begin()[index]; }
 
     /// Appends the \a value as a new element to the end of this vector.
-    void push_back(const T &value)
+    void push_back(const T &value) { emplace_back(value); }
+    /// Moves the \a value as a new element to the end of this vector.
+    void push_back(T &&value) { emplace_back(std::move(value)); }
+
+    /// Constructs a new element at the end of this vector from \a args, and returns a
+    /// reference to it. The capacity grows geometrically, so that appending is amortized
+    /// constant time.
+    template<typename... Args>
+    T &emplace_back(Args &&...args)
     {
-        detach(inner->size + 1);
-        new (end()) T(value);
-        inner->size++;
+        if (inner->refcount != 1 || inner->size == inner->capacity) {
+            // args may refer to an element of this vector, so construct before relocating
+            T value(std::forward<Args>(args)...);
+            grow(inner->size + 1);
+            new (data() + inner->size) T(std::move(value));
+        } else {
+            new (data() + inner->size) T(std::forward<Args>(args)...);
+        }
+        return data()[inner->size++];
     }
-    /// Moves the \a value as a new element to the end of this vector.
-    void push_back(T &&value)
+
+    /// Makes sure that the vector can hold \a new_capacity elements without allocating.
+    void reserve(std::size_t new_capacity)
+    {
+        if (new_capacity > inner->capacity) {
+            detach(new_capacity);
+        }
+    }
+
+    /// Resizes the vector to hold \a new_size elements. New elements are default-constructed.
+    void resize(std::size_t new_size) { resize_with(new_size, [](T *p) { new (p) T(); }); }
+
+    /// Resizes the vector to hold \a new_size elements. New elements are copies of \a value.
+    void resize(std::size_t new_size, const T &value)
     {
-        detach(inner->size + 1);
-        new (end()) T(std::move(value));
-        inner->size++;
+        if (new_size > inner->size && inner->refcount == 1 && new_size > inner->capacity) {
+            // value may refer to an element of this vector
+            T copy(value);
+            resize_with(new_size, [&](T *p) { new (p) T(copy); });
+        } else {
+            resize_with(new_size, [&](T *p) { new (p) T(value); });
+        }
+    }
+
+    /// Inserts a copy of \a value before \a pos, and returns a pointer to the new element.
+    T *insert(const T *pos, const T &value) { return emplace(pos, value); }
+    /// Moves \a value before \a pos, and returns a pointer to the new element.
+    T *insert(const T *pos, T &&value) { return emplace(pos, std::move(value)); }
+
+    /// Inserts copies of the elements in the range [\a first, \a last) before \a pos, and
+    /// returns a pointer to the first inserted element.
+    template<std::forward_iterator It>
+    T *insert(const T *pos, It first, It last)
+    {
+        auto index = std::size_t(pos - cbegin());
+        auto old_size = inner->size;
+        auto count = std::size_t(std::distance(first, last));
+        if (count == 0) {
+            return begin() + index;
+        }
+        if (inner->refcount == 1 && old_size + count > inner->capacity) {
+            // The range may refer to elements of this vector, so copy it before relocating
+            SharedVector range(first, last);
+            grow(old_size + count);
+            append(range.cbegin(), range.cend());
+        } else {
+            grow(old_size + count);
+            append(first, last);
+        }
+        std::rotate(data() + index, data() + old_size, data() + inner->size);
+        return data() + index;
+    }
+
+    /// Constructs a new element from \a args before \a pos, and returns a pointer to it.
+    template<typename... Args>
+    T *emplace(const T *pos, Args &&...args)
+    {
+        auto index = std::size_t(pos - cbegin());
+        emplace_back(std::forward<Args>(args)...);
+        std::rotate(data() + index, data() + inner->size - 1, data() + inner->size);
+        return data() + index;
+    }
+
+    /// Removes the element at \a pos, and returns a pointer to the element that followed it.
+    T *erase(const T *pos) { return erase(pos, pos + 1); }
+
+    /// Removes the elements in the range [\a first, \a last), and returns a pointer to the
+    /// element that followed the last removed element.
+    T *erase(const T *first, const T *last)
+    {
+        auto index = std::size_t(first - cbegin());
+        auto count = std::size_t(last - first);
+        detach(inner->size);
+        auto d = data();
+        std::move(d + index + count, d + inner->size, d + index);
+        truncate(inner->size - count);
+        return d + index;
     }
 
     /// Clears the vector and removes all elements. The capacity remains unaffected.
@@ -151,21 +272,84 @@ struct SharedVector
     std::size_t capacity() const { return inner->capacity; }
 
 private:
+    /// Returns the data of a vector that is not shared
+    T *data() { return reinterpret_cast<T *>(inner + 1); }
+
     void detach(std::size_t expected_capacity)
     {
         if (inner->refcount == 1 && expected_capacity <= inner->capacity) {
             return;
         }
         auto new_array = SharedVector::with_capacity(expected_capacity);
-        auto old_data = reinterpret_cast<const T *>(inner + 1);
+        auto old_data = reinterpret_cast<T *>(inner + 1);
         auto new_data = reinterpret_cast<T *>(new_array.inner + 1);
-        for (std::size_t i = 0; i < inner->size; ++i) {
-            new (new_data + i) T(old_data[i]);
-            new_array.inner->size++;
+        auto size = std::min(inner->size, expected_capacity);
+        if (inner->refcount == 1) {
+            // Nobody else can see the old elements, so relocate them instead of copying
+            for (std::size_t i = 0; i < size; ++i) {
+                new (new_data + i) T(std::move_if_noexcept(old_data[i]));
+                new_array.inner->size++;
+            }
+        } else {
+            for (std::size_t i = 0; i < size; ++i) {
+                new (new_data + i) T(old_data[i]);
+                new_array.inner->size++;
+            }
         }
         *this = std::move(new_array);
     }
 
+    /// Detaches with room for at least \a required_capacity elements, growing the capacity
+    /// geometrically like the Rust implementation does.
+    void grow(std::size_t required_capacity)
+    {
+        auto capacity = inner->capacity;
+        if (capacity < required_capacity) {
+            std::size_t min_non_zero_capacity = sizeof(T) == 1 ? 8 : sizeof(T) <= 1024 ? 4 : 1;
+            capacity = std::max({ capacity * 2, required_capacity, min_non_zero_capacity });
+        }
+        detach(capacity);
+    }
+
+    template<typename Construct>
+    void resize_with(std::size_t new_size, Construct construct)
+    {
+        if (new_size <= inner->size) {
+            if (new_size < inner->size) {
+                detach(inner->size);
+                truncate(new_size);
+            }
+            return;
+        }
+        grow(new_size);
+        while (inner->size < new_size) {
+            construct(data() + inner->size);
+            inner->size++;
+        }
+    }
+
+    /// Copies the elements of the range [\a first, \a last) at the end of a vector that is not
+    /// shared and has the capacity for them
+    template<typename It>
+    void append(It first, It last)
+    {
+        for (; first != last; ++first) {
+            new (data() + inner->size) T(*first);
+            inner->size++;
+        }
+    }
+
+    /// Destroys the elements past \a new_size of a vector that is not shared
+    void truncate(std::size_t new_size)
+    {
+        auto d = data();
+        auto old_size = inner->size;
+        inner->size = new_size;
+        for (auto i = new_size; i < old_size; ++i) {
+            d[i].~T();
+        }
+    }
+
     void drop()
     {
         if (inner->refcount > 0 && (--inner->refcount) == 0) {
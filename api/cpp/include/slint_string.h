@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-Slint-commercial
 
 #pragma once
+#include <algorithm>
 #include <string_view>
 #include "slint_string_internal.h"
 
@@ -216,6 +217,110 @@ private:
     void *inner; // opaque
 };
 
+/// SharedStringBuilder builds a SharedString from pieces and formatted numbers, without a
+/// temporary string for each piece. freeze() returns the result without copying it.
+///
+/// The builder keeps sharing its buffer with the last frozen string. If that string was
+/// destroyed by the time the builder is used again, the buffer is reused without allocating:
+/// \code
+///     slint::SharedStringBuilder builder;
+///     for (auto duration : durations) {
+///         draw_label(builder.append_number(duration, 1).append(" ms").freeze());
+///     }
+/// \endcode
+class SharedStringBuilder
+{
+public:
+    /// Appends \a s to the string being built.
+    SharedStringBuilder &append(std::string_view s)
+    {
+        prepare();
+        buffer += s;
+        return *this;
+    }
+
+    /// Appends the number \a n, formatted like SharedString::from_number().
+    SharedStringBuilder &append_number(double n)
+    {
+        prepare();
+        cbindgen_private::slint_shared_string_append_number(&buffer, n, -1);
+        return *this;
+    }
+
+    /// Appends the number \a n with \a decimals digits after the decimal point.
+    SharedStringBuilder &append_number(double n, int decimals)
+    {
+        prepare();
+        cbindgen_private::slint_shared_string_append_number(&buffer, n, std::max(decimals, 0));
+        return *this;
+    }
+
+    /// Returns a view of the string built so far. The view is only valid until the builder is
+    /// used again.
+    std::string_view view() const { return frozen ? std::string_view() : std::string_view(buffer); }
+
+    /// Returns the string built so far, and starts building a new string. The returned string
+    /// shares its data with the builder, no characters are copied.
+    SharedString freeze()
+    {
+        if (frozen) {
+            return SharedString();
+        }
+        frozen = true;
+        return buffer;
+    }
+
+    /// Discards the string built so far.
+    void clear()
+    {
+        cbindgen_private::slint_shared_string_clear(&buffer);
+        frozen = false;
+    }
+
+private:
+    void prepare()
+    {
+        if (frozen) {
+            clear();
+        }
+    }
+
+    SharedString buffer;
+    bool frozen = false;
+};
+
+/// A set of strings that lets recurring strings, such as the labels and units of a table, share
+/// their data. intern() returns a copy of the string interned before with the same content,
+/// which doesn't allocate, and only allocates the first time a string is seen.
+///
+/// The interner is not thread-safe, but the strings it returns can be used from any thread.
+class SharedStringInterner
+{
+public:
+    /// Creates an empty interner.
+    SharedStringInterner() : inner(cbindgen_private::slint_string_interner_new()) { }
+    ~SharedStringInterner() { cbindgen_private::slint_string_interner_drop(inner); }
+    SharedStringInterner(const SharedStringInterner &) = delete;
+    SharedStringInterner &operator=(const SharedStringInterner &) = delete;
+
+    /// Returns a string equal to \a s, sharing its data with the string interned before, if any.
+    SharedString intern(std::string_view s)
+    {
+        SharedString result;
+        cbindgen_private::slint_string_interner_intern(inner, s.data(), s.size(), &result);
+        return result;
+    }
+
+    /// Returns the number of distinct strings in this interner.
+    std::size_t size() const { return cbindgen_private::slint_string_interner_len(inner); }
+
+    /// Forgets the interned strings. The strings returned by intern() stay valid.
+    void clear() { cbindgen_private::slint_string_interner_clear(inner); }
+
+private:
+    cbindgen_private::StringInterner *inner;
+};
+
 namespace private_api {
 inline cbindgen_private::Slice<uint8_t> string_to_slice(std::string_view str)
 {
@@ -32,6 +32,105 @@ inline void send_keyboard_string_sequence(const Component *component,
                                                     &component->m_window.window_handle());
 }
 
+/// The parameters of benchmark()
+struct BenchmarkOptions
+{
+    /// The number of frames to render
+    uint32_t frames = 100;
+    /// The time by which animations and timers are advanced before each frame
+    std::chrono::milliseconds frame_interval { 16 };
+    /// The size of the window, in physical pixels
+    slint::PhysicalSize size = slint::PhysicalSize({ 800, 600 });
+    /// Also render each frame with the software renderer into an offscreen buffer. Text can only
+    /// be rasterized if the glyphs were embedded when compiling the .slint file (for example
+    /// with the SLINT_EMBED_TEXTURES environment variable set).
+    bool rasterize = false;
+};
+
+/// The time and the allocations spent in one phase of the frames, accumulated over all frames
+struct BenchmarkPhase
+{
+    /// The time spent in this phase over all frames
+    std::chrono::nanoseconds total_time;
+    /// The time of the slowest frame for this phase
+    std::chrono::nanoseconds max_time;
+    /// The number of allocations made by the Slint runtime in this phase over all frames. Only
+    /// counted if the runtime was built with the `count-allocations` feature, which is meant for
+    /// test programs because it replaces the global allocator. Otherwise this is 0.
+    uint64_t allocations;
+};
+
+/// The result of benchmark()
+struct BenchmarkResults
+{
+    /// The number of frames that were rendered
+    uint32_t frames;
+    /// Advancing animations and timers, including the callbacks of the timers
+    BenchmarkPhase animations;
+    /// Evaluating the geometry of every item, which runs the layouts
+    BenchmarkPhase layout;
+    /// Visiting the item tree and reading the properties needed to draw each item, which
+    /// evaluates their dirty bindings
+    BenchmarkPhase bindings;
+    /// Visiting the item tree again with all bindings up to date: the cost of the traversal alone
+    BenchmarkPhase traversal;
+    /// Rendering with the software renderer, if BenchmarkOptions::rasterize is set
+    BenchmarkPhase rasterization;
+    /// The number of items visited per frame, summed over all frames
+    uint64_t items_visited;
+    /// The number of items drawn per frame, summed over all frames
+    uint64_t items_drawn;
+};
+
+/// Renders `options.frames` frames of `component` without showing them, advancing the mocked
+/// time by `options.frame_interval` before each frame, and returns how long each phase took.
+/// init() must have been called before creating the component.
+///
+/// The timings are only comparable between runs on the same machine, but the allocation and
+/// item counts are deterministic, which makes them suitable to detect regressions in CI.
+template<typename Component>
+inline BenchmarkResults benchmark(const Component *component, const BenchmarkOptions &options = {})
+{
+    cbindgen_private::TestingBenchmarkOptions ffi_options {
+        options.frames, uint64_t(options.frame_interval.count()), options.size.width,
+        options.size.height, options.rasterize
+    };
+    cbindgen_private::TestingBenchmarkResults r;
+    cbindgen_private::slint_testing_benchmark(&component->m_window.window_handle(), &ffi_options,
+                                              &r);
+    auto phase = [](const cbindgen_private::TestingBenchmarkPhase &p) {
+        return BenchmarkPhase { std::chrono::nanoseconds(p.total_ns),
+                                std::chrono::nanoseconds(p.max_ns), p.allocations };
+    };
+    return BenchmarkResults { r.frames,
+                              phase(r.animations),
+                              phase(r.layout),
+                              phase(r.bindings),
+                              phase(r.traversal),
+                              phase(r.rasterization),
+                              r.items_visited,
+                              r.items_drawn };
+}
+
+/// Writes one line per phase of `results`, with the average time per frame
+inline std::ostream &operator<<(std::ostream &stream, const BenchmarkResults &results)
+{
+    auto frames = std::max(results.frames, 1u);
+    auto phase = [&](const char *name, const BenchmarkPhase &p) {
+        using micros = std::chrono::duration<double, std::micro>;
+        stream << name << ": " << micros(p.total_time).count() / frames << "us/frame (max "
+               << micros(p.max_time).count() << "us), " << p.allocations << " allocations\n";
+    };
+    stream << results.frames << " frames, " << results.items_visited / frames
+           << " items visited and " << results.items_drawn / frames << " drawn per frame\n";
+    phase("animations", results.animations);
+    phase("layout", results.layout);
+    phase("bindings", results.bindings);
+    phase("traversal", results.traversal);
+    phase("rasterization", results.rasterization);
+    return stream;
+}
+
 #define assert_eq(A, B)                                                                            \
     slint::testing::private_api::assert_eq_impl(A, B, #A, #B, __FILE__, __LINE__)
 
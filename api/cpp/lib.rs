@@ -7,6 +7,10 @@
 use i_slint_core::window::{ffi::WindowAdapterRcOpaque, WindowAdapter};
 use std::rc::Rc;
 
+mod platform;
+#[cfg(feature = "testing")]
+mod testing;
+
 #[doc(hidden)]
 #[cold]
 pub fn use_modules() -> usize {
@@ -31,32 +35,35 @@ pub fn use_modules() -> usize {
     i_slint_backend_selector::with_platform(|b| b.run_event_loop());
 }
 
-/// Will execute the given functor in the main thread
+/// The user data of the functors posted to an event loop, dropped with them
+struct UserData {
+    user_data: *mut c_void,
+    drop_user_data: Option<extern "C" fn(*mut c_void)>,
+}
+impl Drop for UserData {
+    fn drop(&mut self) {
+        if let Some(x) = self.drop_user_data {
+            x(self.user_data)
+        }
+    }
+}
+unsafe impl Send for UserData {}
+
+/// Will execute the given functor in the main thread. Returns false, after dropping `user_data`,
+/// if there is no main event loop or if it was terminated.
 #[no_mangle]
 pub unsafe extern "C" fn slint_post_event(
     event: extern "C" fn(user_data: *mut c_void),
     user_data: *mut c_void,
     drop_user_data: Option<extern "C" fn(*mut c_void)>,
-) {
-    struct UserData {
-        user_data: *mut c_void,
-        drop_user_data: Option<extern "C" fn(*mut c_void)>,
-    }
-    impl Drop for UserData {
-        fn drop(&mut self) {
-            if let Some(x) = self.drop_user_data {
-                x(self.user_data)
-            }
-        }
-    }
-    unsafe impl Send for UserData {}
+) -> bool {
     let ud = UserData { user_data, drop_user_data };
 
     i_slint_core::api::invoke_from_event_loop(move || {
         let ud = &ud;
         event(ud.user_data);
     })
-    .unwrap();
+    .is_ok()
 }
 
 #[no_mangle]
@@ -64,6 +71,57 @@ unsafe impl Send for UserData {}
     i_slint_core::api::quit_event_loop().unwrap();
 }
 
+/// An `EventLoopContext`, boxed
+pub type EventLoopContextOpaque = *const c_void;
+
+/// Returns the event loop of the current thread, or null if no platform was set on this thread
+#[no_mangle]
+pub extern "C" fn slint_event_loop_context_current() -> EventLoopContextOpaque {
+    match i_slint_core::api::EventLoopContext::current() {
+        Some(context) => Box::into_raw(Box::new(context)) as EventLoopContextOpaque,
+        None => core::ptr::null(),
+    }
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn slint_event_loop_context_clone(
+    context: EventLoopContextOpaque,
+) -> EventLoopContextOpaque {
+    let context = &*(context as *const i_slint_core::api::EventLoopContext);
+    Box::into_raw(Box::new(context.clone())) as EventLoopContextOpaque
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn slint_event_loop_context_drop(context: EventLoopContextOpaque) {
+    drop(Box::from_raw(context as *mut i_slint_core::api::EventLoopContext));
+}
+
+/// Will execute the given functor in the thread of the event loop of `context`. Returns false,
+/// after dropping `user_data`, if that event loop was terminated.
+#[no_mangle]
+pub unsafe extern "C" fn slint_event_loop_context_post_event(
+    context: EventLoopContextOpaque,
+    event: extern "C" fn(user_data: *mut c_void),
+    user_data: *mut c_void,
+    drop_user_data: Option<extern "C" fn(*mut c_void)>,
+) -> bool {
+    let ud = UserData { user_data, drop_user_data };
+
+    let context = &*(context as *const i_slint_core::api::EventLoopContext);
+    context
+        .invoke_from_event_loop(move || {
+            let ud = &ud;
+            event(ud.user_data);
+        })
+        .is_ok()
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn slint_event_loop_context_quit(context: EventLoopContextOpaque) -> bool {
+    let context = &*(context as *const i_slint_core::api::EventLoopContext);
+    context.quit_event_loop().is_ok()
+}
+
 #[no_mangle]
 pub unsafe extern "C" fn slint_register_font_from_path(
     win: *const WindowAdapterRcOpaque,
@@ -97,6 +155,34 @@ unsafe impl Send for UserData {}
     )
 }
 
+#[no_mangle]
+pub unsafe extern "C" fn slint_prewarm_glyph_cache(
+    win: *const WindowAdapterRcOpaque,
+    family: &i_slint_core::SharedString,
+    weight: i32,
+    pixel_sizes: i_slint_core::slice::Slice<f32>,
+    characters: &i_slint_core::SharedString,
+) {
+    let window_adapter = &*(win as *const Rc<dyn WindowAdapter>);
+    let font_request = i_slint_core::graphics::FontRequest {
+        family: (!family.is_empty()).then(|| family.clone()),
+        weight: (weight > 0).then(|| weight),
+        ..Default::default()
+    };
+    let pixel_sizes = pixel_sizes
+        .iter()
+        .map(|size| i_slint_core::lengths::LogicalLength::new(*size))
+        .collect::<Vec<_>>();
+    let scale_factor =
+        i_slint_core::window::WindowInner::from_pub(window_adapter.window()).scale_factor();
+    window_adapter.renderer().prewarm_glyph_cache(
+        font_request,
+        &pixel_sizes,
+        characters,
+        i_slint_core::lengths::ScaleFactor::new(scale_factor),
+    );
+}
+
 #[cfg(feature = "testing")]
 #[no_mangle]
 pub unsafe extern "C" fn slint_testing_init_backend() {
@@ -0,0 +1,426 @@
+// Copyright © SixtyFPS GmbH <info@slint-ui.com>
+// SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-Slint-commercial
+
+//! Functions used by the C++ platform API (slint_platform.h) to implement a custom platform
+//! rendering with the software renderer.
+
+use core::ffi::c_void;
+use i_slint_core::api::{EventLoopError, LogicalPosition, PhysicalSize, WindowEvent};
+use i_slint_core::graphics::{IntRect, Rgb8Pixel};
+use i_slint_core::items::PointerEventButton;
+use i_slint_core::platform::{EventLoopProxy, Platform};
+use i_slint_core::software_renderer::{
+    LineBufferProvider, MinimalSoftwareWindow, Rgb565Pixel, SoftwareRenderer, TargetPixel,
+};
+use i_slint_core::window::{ffi::WindowAdapterRcOpaque, WindowAdapter};
+use std::rc::Rc;
+use std::sync::{Arc, RwLock};
+
+type PlatformUserData = *mut c_void;
+
+struct CppPlatform {
+    user_data: PlatformUserData,
+    drop: unsafe extern "C" fn(PlatformUserData),
+    window_factory: unsafe extern "C" fn(PlatformUserData, *mut WindowAdapterRcOpaque),
+    run_event_loop: unsafe extern "C" fn(PlatformUserData),
+    quit_event_loop: unsafe extern "C" fn(PlatformUserData),
+    invoke_from_event_loop: unsafe extern "C" fn(PlatformUserData, PlatformTaskOpaque),
+    duration_since_start: unsafe extern "C" fn(PlatformUserData) -> u64,
+    /// False once the platform is dropped, which the proxies of its event loop check
+    alive: Arc<RwLock<bool>>,
+}
+
+impl Drop for CppPlatform {
+    fn drop(&mut self) {
+        *self.alive.write().unwrap() = false;
+        unsafe { (self.drop)(self.user_data) };
+    }
+}
+
+impl Platform for CppPlatform {
+    fn create_window_adapter(&self) -> Rc<dyn WindowAdapter> {
+        let mut window_adapter = core::mem::MaybeUninit::<Rc<dyn WindowAdapter>>::uninit();
+        unsafe {
+            (self.window_factory)(
+                self.user_data,
+                window_adapter.as_mut_ptr() as *mut WindowAdapterRcOpaque,
+            );
+            window_adapter.assume_init()
+        }
+    }
+
+    fn run_event_loop(&self) {
+        unsafe { (self.run_event_loop)(self.user_data) };
+    }
+
+    fn new_event_loop_proxy(&self) -> Option<Box<dyn EventLoopProxy>> {
+        Some(Box::new(CppEventLoopProxy {
+            user_data: self.user_data,
+            quit_event_loop: self.quit_event_loop,
+            invoke_from_event_loop: self.invoke_from_event_loop,
+            alive: self.alive.clone(),
+        }))
+    }
+
+    fn duration_since_start(&self) -> core::time::Duration {
+        core::time::Duration::from_millis(unsafe { (self.duration_since_start)(self.user_data) })
+    }
+}
+
+struct CppEventLoopProxy {
+    user_data: PlatformUserData,
+    quit_event_loop: unsafe extern "C" fn(PlatformUserData),
+    invoke_from_event_loop: unsafe extern "C" fn(PlatformUserData, PlatformTaskOpaque),
+    alive: Arc<RwLock<bool>>,
+}
+
+// Safety: the C++ Platform documents that quit_event_loop() and invoke_from_event_loop() must be
+// thread-safe, and the platform is not destroyed while `alive` is read-locked. The proxy can
+// outlive the platform when the thread that registered it exits.
+unsafe impl Send for CppEventLoopProxy {}
+unsafe impl Sync for CppEventLoopProxy {}
+
+impl EventLoopProxy for CppEventLoopProxy {
+    fn quit_event_loop(&self) -> Result<(), EventLoopError> {
+        let alive = self.alive.read().unwrap();
+        if !*alive {
+            return Err(EventLoopError::EventLoopTerminated);
+        }
+        unsafe { (self.quit_event_loop)(self.user_data) };
+        Ok(())
+    }
+
+    fn invoke_from_event_loop(
+        &self,
+        event: Box<dyn FnOnce() + Send>,
+    ) -> Result<(), EventLoopError> {
+        let alive = self.alive.read().unwrap();
+        if !*alive {
+            return Err(EventLoopError::EventLoopTerminated);
+        }
+        let task = PlatformTaskOpaque(Box::into_raw(Box::new(event)) as *mut c_void);
+        unsafe { (self.invoke_from_event_loop)(self.user_data, task) };
+        Ok(())
+    }
+}
+
+/// A functor queued with invoke_from_event_loop(), to be run or dropped exactly once
+#[repr(C)]
+pub struct PlatformTaskOpaque(*mut c_void);
+
+/// Registers the C++ platform on the current thread. If `main` is true, the platform runs the main
+/// event loop. Returns false, after dropping `user_data`, if a platform was already set on this
+/// thread, or if `main` is true and another thread runs the main event loop.
+#[no_mangle]
+pub unsafe extern "C" fn slint_platform_register(
+    user_data: PlatformUserData,
+    drop: unsafe extern "C" fn(PlatformUserData),
+    window_factory: unsafe extern "C" fn(PlatformUserData, *mut WindowAdapterRcOpaque),
+    run_event_loop: unsafe extern "C" fn(PlatformUserData),
+    quit_event_loop: unsafe extern "C" fn(PlatformUserData),
+    invoke_from_event_loop: unsafe extern "C" fn(PlatformUserData, PlatformTaskOpaque),
+    duration_since_start: unsafe extern "C" fn(PlatformUserData) -> u64,
+    main: bool,
+) -> bool {
+    let platform = CppPlatform {
+        user_data,
+        drop,
+        window_factory,
+        run_event_loop,
+        quit_event_loop,
+        invoke_from_event_loop,
+        duration_since_start,
+        alive: Arc::new(RwLock::new(true)),
+    };
+    if main {
+        i_slint_core::platform::set_platform(Box::new(platform)).is_ok()
+    } else {
+        i_slint_core::platform::set_thread_platform(Box::new(platform)).is_ok()
+    }
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn slint_platform_task_run(task: PlatformTaskOpaque) {
+    let event = *Box::from_raw(task.0 as *mut Box<dyn FnOnce() + Send>);
+    event();
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn slint_platform_task_drop(task: PlatformTaskOpaque) {
+    drop(Box::from_raw(task.0 as *mut Box<dyn FnOnce() + Send>));
+}
+
+#[no_mangle]
+pub extern "C" fn slint_platform_update_timers_and_animations() {
+    i_slint_core::platform::update_timers_and_animations();
+}
+
+/// Returns the number of milliseconds until the next timer, or u64::MAX if there is none
+#[no_mangle]
+pub extern "C" fn slint_platform_duration_until_next_timer_update() -> u64 {
+    i_slint_core::platform::duration_until_next_timer_update()
+        .map_or(u64::MAX, |duration| duration.as_millis() as u64)
+}
+
+/// The MinimalSoftwareWindow for each supported buffer age
+enum SoftwareWindow {
+    NewBuffer(Rc<MinimalSoftwareWindow<0>>),
+    ReusedBuffer(Rc<MinimalSoftwareWindow<1>>),
+    SwappedBuffers(Rc<MinimalSoftwareWindow<2>>),
+}
+
+impl SoftwareWindow {
+    fn window(&self) -> &i_slint_core::api::Window {
+        match self {
+            Self::NewBuffer(w) => w,
+            Self::ReusedBuffer(w) => w,
+            Self::SwappedBuffers(w) => w,
+        }
+    }
+}
+
+/// The renderer of a SoftwareWindow, only valid during slint_software_window_draw_if_needed
+enum SoftwareRendererRef<'a> {
+    NewBuffer(&'a SoftwareRenderer<0>),
+    ReusedBuffer(&'a SoftwareRenderer<1>),
+    SwappedBuffers(&'a SoftwareRenderer<2>),
+}
+
+pub type SoftwareWindowOpaque = *const c_void;
+pub type SoftwareRendererOpaque = *const c_void;
+
+/// Creates a window rendered with the software renderer. `buffer_age` is the number of frames
+/// since the buffer passed to the renderer was last rendered into: 0 if it is always a new
+/// buffer, 1 if the same buffer is reused, 2 for swapped double buffers.
+#[no_mangle]
+pub extern "C" fn slint_software_window_new(buffer_age: u32) -> SoftwareWindowOpaque {
+    let window = match buffer_age {
+        0 => SoftwareWindow::NewBuffer(MinimalSoftwareWindow::new()),
+        1 => SoftwareWindow::ReusedBuffer(MinimalSoftwareWindow::new()),
+        _ => SoftwareWindow::SwappedBuffers(MinimalSoftwareWindow::new()),
+    };
+    Box::into_raw(Box::new(window)) as SoftwareWindowOpaque
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn slint_software_window_drop(window: SoftwareWindowOpaque) {
+    drop(Box::from_raw(window as *mut SoftwareWindow));
+}
+
+/// Writes a new reference to the window adapter of `window` to `out`
+#[no_mangle]
+pub unsafe extern "C" fn slint_software_window_adapter(
+    window: SoftwareWindowOpaque,
+    out: *mut WindowAdapterRcOpaque,
+) {
+    let window_adapter: Rc<dyn WindowAdapter> = match &*(window as *const SoftwareWindow) {
+        SoftwareWindow::NewBuffer(w) => w.clone(),
+        SoftwareWindow::ReusedBuffer(w) => w.clone(),
+        SoftwareWindow::SwappedBuffers(w) => w.clone(),
+    };
+    core::ptr::write(out as *mut Rc<dyn WindowAdapter>, window_adapter);
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn slint_software_window_set_size(
+    window: SoftwareWindowOpaque,
+    width: u32,
+    height: u32,
+) {
+    (*(window as *const SoftwareWindow)).window().set_size(PhysicalSize::new(width, height));
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn slint_software_window_has_active_animations(
+    window: SoftwareWindowOpaque,
+) -> bool {
+    (*(window as *const SoftwareWindow)).window().has_active_animations()
+}
+
+/// Kind of a pointer event passed to slint_software_window_dispatch_pointer_event
+#[repr(u8)]
+pub enum PlatformPointerEventKind {
+    Pressed,
+    Released,
+    Moved,
+    Scrolled,
+    Exited,
+}
+
+/// Dispatches a pointer event at the logical position `x`, `y`. `button` is only used for
+/// pressed and released events, `delta_x` and `delta_y` for scroll events.
+#[no_mangle]
+pub unsafe extern "C" fn slint_software_window_dispatch_pointer_event(
+    window: SoftwareWindowOpaque,
+    kind: PlatformPointerEventKind,
+    x: f32,
+    y: f32,
+    button: PointerEventButton,
+    delta_x: f32,
+    delta_y: f32,
+) {
+    let position = LogicalPosition::new(x, y);
+    let event = match kind {
+        PlatformPointerEventKind::Pressed => WindowEvent::PointerPressed { position, button },
+        PlatformPointerEventKind::Released => WindowEvent::PointerReleased { position, button },
+        PlatformPointerEventKind::Moved => WindowEvent::PointerMoved { position },
+        PlatformPointerEventKind::Scrolled => {
+            WindowEvent::PointerScrolled { position, delta_x, delta_y }
+        }
+        PlatformPointerEventKind::Exited => WindowEvent::PointerExited,
+    };
+    (*(window as *const SoftwareWindow)).window().dispatch_event(event);
+}
+
+/// If the window needs to be redrawn, calls `render` with `user_data` and the renderer to use,
+/// and returns true.
+#[no_mangle]
+pub unsafe extern "C" fn slint_software_window_draw_if_needed(
+    window: SoftwareWindowOpaque,
+    user_data: *mut c_void,
+    render: unsafe extern "C" fn(*mut c_void, SoftwareRendererOpaque),
+) -> bool {
+    let render_with = |renderer: SoftwareRendererRef| {
+        render(user_data, &renderer as *const SoftwareRendererRef as SoftwareRendererOpaque)
+    };
+    match &*(window as *const SoftwareWindow) {
+        SoftwareWindow::NewBuffer(w) => {
+            w.draw_if_needed(|r| render_with(SoftwareRendererRef::NewBuffer(r)))
+        }
+        SoftwareWindow::ReusedBuffer(w) => {
+            w.draw_if_needed(|r| render_with(SoftwareRendererRef::ReusedBuffer(r)))
+        }
+        SoftwareWindow::SwappedBuffers(w) => {
+            w.draw_if_needed(|r| render_with(SoftwareRendererRef::SwappedBuffers(r)))
+        }
+    }
+}
+
+/// The rectangle of the buffer that was redrawn, in physical pixels
+#[repr(C)]
+pub struct PlatformRenderedRegion {
+    pub x: i32,
+    pub y: i32,
+    pub width: i32,
+    pub height: i32,
+}
+
+impl From<IntRect> for PlatformRenderedRegion {
+    fn from(rect: IntRect) -> Self {
+        Self {
+            x: rect.origin.x,
+            y: rect.origin.y,
+            width: rect.size.width,
+            height: rect.size.height,
+        }
+    }
+}
+
+unsafe fn render_to_buffer(
+    renderer: SoftwareRendererOpaque,
+    buffer: &mut [impl TargetPixel],
+    pixel_stride: usize,
+) -> PlatformRenderedRegion {
+    match &*(renderer as *const SoftwareRendererRef) {
+        SoftwareRendererRef::NewBuffer(r) => r.render(buffer, pixel_stride),
+        SoftwareRendererRef::ReusedBuffer(r) => r.render(buffer, pixel_stride),
+        SoftwareRendererRef::SwappedBuffers(r) => r.render(buffer, pixel_stride),
+    }
+    .into()
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn slint_software_renderer_render_rgb565(
+    renderer: SoftwareRendererOpaque,
+    buffer: *mut u16,
+    buffer_len: usize,
+    pixel_stride: usize,
+) -> PlatformRenderedRegion {
+    let buffer = core::slice::from_raw_parts_mut(buffer as *mut Rgb565Pixel, buffer_len);
+    render_to_buffer(renderer, buffer, pixel_stride)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn slint_software_renderer_render_rgb8(
+    renderer: SoftwareRendererOpaque,
+    buffer: *mut u8,
+    buffer_len: usize,
+    pixel_stride: usize,
+) -> PlatformRenderedRegion {
+    let buffer = core::slice::from_raw_parts_mut(buffer as *mut Rgb8Pixel, buffer_len);
+    render_to_buffer(renderer, buffer, pixel_stride)
+}
+
+/// Forwards the lines to render to the C++ callback
+struct CppLineBufferProvider {
+    user_data: *mut c_void,
+    /// Called with the line, the range within the line to render, and the function and data to
+    /// call back with the buffer for that range
+    process_line: unsafe extern "C" fn(
+        *mut c_void,
+        usize,
+        usize,
+        usize,
+        unsafe extern "C" fn(*mut c_void, *mut u16, usize),
+        *mut c_void,
+    ),
+}
+
+impl LineBufferProvider for CppLineBufferProvider {
+    type TargetPixel = Rgb565Pixel;
+
+    fn process_line(
+        &mut self,
+        line: usize,
+        range: core::ops::Range<usize>,
+        render_fn: impl FnOnce(&mut [Self::TargetPixel]),
+    ) {
+        unsafe extern "C" fn render_line<F: FnOnce(&mut [Rgb565Pixel])>(
+            render_fn: *mut c_void,
+            buffer: *mut u16,
+            buffer_len: usize,
+        ) {
+            if let Some(render_fn) = (*(render_fn as *mut Option<F>)).take() {
+                render_fn(core::slice::from_raw_parts_mut(buffer as *mut Rgb565Pixel, buffer_len));
+            }
+        }
+        /// Returns `render_line` for the type of `render_fn`, which can't be named
+        fn line_fn<F: FnOnce(&mut [Rgb565Pixel])>(
+            _: &Option<F>,
+        ) -> unsafe extern "C" fn(*mut c_void, *mut u16, usize) {
+            render_line::<F>
+        }
+        let mut render_fn = Some(render_fn);
+        unsafe {
+            (self.process_line)(
+                self.user_data,
+                line,
+                range.start,
+                range.end,
+                line_fn(&render_fn),
+                &mut render_fn as *mut Option<_> as *mut c_void,
+            )
+        };
+    }
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn slint_software_renderer_render_by_line_rgb565(
+    renderer: SoftwareRendererOpaque,
+    user_data: *mut c_void,
+    process_line: unsafe extern "C" fn(
+        *mut c_void,
+        usize,
+        usize,
+        usize,
+        unsafe extern "C" fn(*mut c_void, *mut u16, usize),
+        *mut c_void,
+    ),
+) {
+    let provider = CppLineBufferProvider { user_data, process_line };
+    match &*(renderer as *const SoftwareRendererRef) {
+        SoftwareRendererRef::NewBuffer(r) => r.render_by_line(provider),
+        SoftwareRendererRef::ReusedBuffer(r) => r.render_by_line(provider),
+        SoftwareRendererRef::SwappedBuffers(r) => r.render_by_line(provider),
+    }
+}
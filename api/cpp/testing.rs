@@ -0,0 +1,78 @@
+// Copyright © SixtyFPS GmbH <info@slint-ui.com>
+// SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-Slint-commercial
+
+//! Functions used by slint::testing::benchmark() in slint_testing.h
+
+use i_slint_backend_testing::{BenchmarkOptions, PhaseStatistics};
+use i_slint_core::api::PhysicalSize;
+use i_slint_core::window::WindowAdapterRc;
+
+/// Count the allocations of the runtime, for the benchmark results. This replaces the allocator
+/// of the whole program, so it is only installed by test programs that opt in.
+#[cfg(feature = "count-allocations")]
+#[global_allocator]
+static ALLOCATOR: i_slint_backend_testing::CountingAllocator =
+    i_slint_backend_testing::CountingAllocator;
+
+#[repr(C)]
+pub struct TestingBenchmarkOptions {
+    frames: u32,
+    frame_interval_ms: u64,
+    width: u32,
+    height: u32,
+    rasterize: bool,
+}
+
+#[repr(C)]
+pub struct TestingBenchmarkPhase {
+    total_ns: u64,
+    max_ns: u64,
+    allocations: u64,
+}
+
+impl From<PhaseStatistics> for TestingBenchmarkPhase {
+    fn from(phase: PhaseStatistics) -> Self {
+        Self {
+            total_ns: phase.total_time.as_nanos() as u64,
+            max_ns: phase.max_time.as_nanos() as u64,
+            allocations: phase.allocations as u64,
+        }
+    }
+}
+
+#[repr(C)]
+pub struct TestingBenchmarkResults {
+    frames: u32,
+    animations: TestingBenchmarkPhase,
+    layout: TestingBenchmarkPhase,
+    bindings: TestingBenchmarkPhase,
+    traversal: TestingBenchmarkPhase,
+    rasterization: TestingBenchmarkPhase,
+    items_visited: u64,
+    items_drawn: u64,
+}
+
+#[no_mangle]
+pub extern "C" fn slint_testing_benchmark(
+    window_adapter: &WindowAdapterRc,
+    options: &TestingBenchmarkOptions,
+    results: &mut TestingBenchmarkResults,
+) {
+    let options = BenchmarkOptions {
+        frames: options.frames as usize,
+        frame_interval: core::time::Duration::from_millis(options.frame_interval_ms),
+        size: PhysicalSize::new(options.width, options.height),
+        rasterize: options.rasterize,
+    };
+    let r = i_slint_backend_testing::benchmark_frames(window_adapter, &options);
+    *results = TestingBenchmarkResults {
+        frames: r.frames as u32,
+        animations: r.animations.into(),
+        layout: r.layout.into(),
+        bindings: r.bindings.into(),
+        traversal: r.traversal.into(),
+        rasterization: r.rasterization.into(),
+        items_visited: r.items_visited as u64,
+        items_drawn: r.items_drawn as u64,
+    };
+}
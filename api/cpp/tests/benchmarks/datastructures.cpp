@@ -0,0 +1,73 @@
+// Copyright © SixtyFPS GmbH <info@slint-ui.com>
+// SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-Slint-commercial
+
+#define CATCH_CONFIG_MAIN
+#include "catch2/catch.hpp"
+
+#include <slint.h>
+
+TEST_CASE("SharedString")
+{
+    for (std::size_t length : { 8, 64, 1'024 }) {
+        std::string text(length, 'x');
+        BENCHMARK("Construct from " + std::to_string(length) + " bytes")
+        {
+            return slint::SharedString(text);
+        };
+    }
+
+    BENCHMARK("from_number")
+    {
+        return slint::SharedString::from_number(12345.5);
+    };
+
+    slint::SharedString shared("A string shared by several properties");
+    BENCHMARK("Copy")
+    {
+        return slint::SharedString(shared);
+    };
+
+    BENCHMARK("Append 100 times")
+    {
+        slint::SharedString result;
+        for (int i = 0; i < 100; ++i) {
+            result += "item ";
+        }
+        return result;
+    };
+}
+
+TEST_CASE("SharedVector")
+{
+    for (std::size_t size : { 1'000, 100'000, 1'000'000 }) {
+        std::vector<int> values(size, 42);
+        auto suffix = " of " + std::to_string(size) + " ints";
+
+        BENCHMARK("Construct" + suffix)
+        {
+            return slint::SharedVector<int>(values.begin(), values.end());
+        };
+
+        BENCHMARK("push_back" + suffix)
+        {
+            slint::SharedVector<int> vector;
+            for (std::size_t i = 0; i < size; ++i) {
+                vector.push_back(int(i));
+            }
+            return vector;
+        };
+
+        slint::SharedVector<int> shared(values.begin(), values.end());
+        BENCHMARK("Copy" + suffix)
+        {
+            return slint::SharedVector<int>(shared);
+        };
+
+        BENCHMARK("Copy and modify" + suffix)
+        {
+            slint::SharedVector<int> copy(shared);
+            copy[0] = 1;
+            return copy;
+        };
+    }
+}
@@ -0,0 +1,65 @@
+// Copyright © SixtyFPS GmbH <info@slint-ui.com>
+// SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-Slint-commercial
+
+#define CATCH_CONFIG_MAIN
+#include "catch2/catch.hpp"
+
+#include <slint.h>
+#include <slint_interpreter.h>
+
+using namespace slint::interpreter;
+
+TEST_CASE("Interpreter")
+{
+    constexpr std::string_view source = R"(
+        export Test := Rectangle {
+            property <int> value;
+            property <int> doubled: value * 2;
+            callback compute(int, int) -> int;
+            compute(a, b) => { a * b + value }
+        }
+    )";
+    ComponentCompiler compiler;
+    auto definition = compiler.build_from_source(source, "");
+    REQUIRE(definition.has_value());
+    auto instance = definition->create();
+    int counter = 0;
+
+    BENCHMARK("set_property by name")
+    {
+        return instance->set_property("value", Value(double(++counter)));
+    };
+
+    BENCHMARK("get_property of a binding by name")
+    {
+        instance->set_property("value", Value(double(++counter)));
+        return instance->get_property("doubled");
+    };
+
+    BENCHMARK("invoke_callback by name")
+    {
+        Value args[] = { Value(double(++counter)), Value(3.) };
+        return instance->invoke_callback("compute", args);
+    };
+
+    auto value = *definition->property_handle("value");
+    auto doubled = *definition->property_handle("doubled");
+    auto compute = *definition->callback_handle("compute");
+
+    BENCHMARK("set_property by handle")
+    {
+        return instance->set_property(value, Value(double(++counter)));
+    };
+
+    BENCHMARK("get_property of a binding by handle")
+    {
+        instance->set_property(value, Value(double(++counter)));
+        return instance->get_property(doubled);
+    };
+
+    BENCHMARK("invoke_callback by handle")
+    {
+        Value args[] = { Value(double(++counter)), Value(3.) };
+        return instance->invoke_callback(compute, args);
+    };
+}
@@ -0,0 +1,113 @@
+// Copyright © SixtyFPS GmbH <info@slint-ui.com>
+// SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-Slint-commercial
+
+#define CATCH_CONFIG_MAIN
+#include "catch2/catch.hpp"
+
+#include <slint.h>
+
+namespace {
+constexpr int row_counts[] = { 1'000, 10'000, 100'000, 1'000'000 };
+
+/// Returns a model with the numbers from 0 to count - 1, shuffled so that sorting has work to do
+std::shared_ptr<slint::VectorModel<int>> shuffled_rows(int count)
+{
+    std::vector<int> rows(count);
+    for (int i = 0; i < count; ++i) {
+        // 7919 is a prime, so this is a permutation for the powers of ten
+        rows[i] = int((int64_t(i) * 7919) % count);
+    }
+    return std::make_shared<slint::VectorModel<int>>(std::move(rows));
+}
+
+int64_t checksum(int value)
+{
+    return value;
+}
+
+int64_t checksum(const slint::SharedString &value)
+{
+    return std::string_view(value).size();
+}
+
+/// Reads every row of the model, like a view showing all of them
+template<typename ModelData>
+int64_t read_rows(const slint::Model<ModelData> &model)
+{
+    int64_t sum = 0;
+    for (int i = 0; i < model.row_count(); ++i) {
+        model.visit_row_data(i, [&](const ModelData &value) { sum += checksum(value); });
+    }
+    return sum;
+}
+
+std::string name(std::string_view what, int count)
+{
+    return std::string(what) + " (" + std::to_string(count) + " rows)";
+}
+}
+
+TEST_CASE("Model adapters")
+{
+    for (int count : row_counts) {
+        auto source = shuffled_rows(count);
+
+        BENCHMARK(name("FilterModel", count))
+        {
+            slint::FilterModel<int> model(source, [](int value) { return value % 2 == 0; });
+            return read_rows(model);
+        };
+
+        BENCHMARK(name("MapModel", count))
+        {
+            slint::MapModel<int, int> model(source, [](int value) { return value * 2; });
+            return read_rows(model);
+        };
+
+        BENCHMARK(name("SortModel", count))
+        {
+            slint::SortModel<int> model(source, std::less<int>());
+            return read_rows(model);
+        };
+
+        BENCHMARK(name("SortByKeyModel", count))
+        {
+            slint::SortByKeyModel<int, int> model(source, [](int value) { return -value; });
+            return read_rows(model);
+        };
+    }
+}
+
+TEST_CASE("Model pipelines")
+{
+    for (int count : row_counts) {
+        auto source = shuffled_rows(count);
+        auto make_pipeline = [&] {
+            auto filtered = std::make_shared<slint::FilterModel<int>>(
+                    source, [](int value) { return value % 3 != 0; });
+            auto sorted = std::make_shared<slint::SortModel<int>>(filtered, std::less<int>());
+            return std::make_shared<slint::MapModel<int, slint::SharedString>>(
+                    sorted, [](int value) { return slint::SharedString::from_number(value); });
+        };
+
+        BENCHMARK(name("Filter, sort and map", count))
+        {
+            return read_rows(*make_pipeline());
+        };
+
+        // The pipeline stays attached to the source, which changes 100 rows spread over the
+        // model. Adding a multiple of 3 larger than count keeps the rows in the same filter
+        // class but moves them in the sort order.
+        auto pipeline = make_pipeline();
+        read_rows(*pipeline);
+        const int offset = 3 * count;
+        BENCHMARK(name("Update 100 rows of a pipeline", count))
+        {
+            for (int i = 0; i < count; i += count / 100) {
+                int value = *source->row_data(i);
+                source->set_row_data(i, value < count ? value + offset : value - offset);
+            }
+            return read_rows(*pipeline);
+        };
+    }
+}
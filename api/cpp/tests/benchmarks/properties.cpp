@@ -0,0 +1,48 @@
+// Copyright © SixtyFPS GmbH <info@slint-ui.com>
+// SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-Slint-commercial
+
+#define CATCH_CONFIG_MAIN
+#include "catch2/catch.hpp"
+
+#include <slint.h>
+
+using slint::private_api::Property;
+
+TEST_CASE("Binding propagation")
+{
+    for (int depth : { 10, 100, 1'000 }) {
+        // Each property of the chain is bound to the previous one
+        std::vector<std::unique_ptr<Property<int>>> chain;
+        chain.push_back(std::make_unique<Property<int>>(0));
+        for (int i = 1; i < depth; ++i) {
+            chain.push_back(std::make_unique<Property<int>>());
+            chain[i]->set_binding([previous = chain[i - 1].get()] { return previous->get() + 1; });
+        }
+        int value = 0;
+        BENCHMARK("Chain of depth " + std::to_string(depth))
+        {
+            chain.front()->set(++value);
+            return chain.back()->get();
+        };
+    }
+
+    for (int fan_out : { 10, 100, 1'000, 10'000 }) {
+        // All the properties are bound to the same source
+        Property<int> source(0);
+        std::vector<std::unique_ptr<Property<int>>> dependents;
+        for (int i = 0; i < fan_out; ++i) {
+            dependents.push_back(std::make_unique<Property<int>>());
+            dependents.back()->set_binding([&source, i] { return source.get() + i; });
+        }
+        int value = 0;
+        BENCHMARK("Fan-out to " + std::to_string(fan_out) + " bindings")
+        {
+            source.set(++value);
+            int64_t sum = 0;
+            for (const auto &dependent : dependents) {
+                sum += dependent->get();
+            }
+            return sum;
+        };
+    }
+}
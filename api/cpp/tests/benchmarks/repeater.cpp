@@ -0,0 +1,46 @@
+// Copyright © SixtyFPS GmbH <info@slint-ui.com>
+// SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-Slint-commercial
+
+#define CATCH_CONFIG_MAIN
+#include "catch2/catch.hpp"
+
+#include "repeater.h"
+#include <numeric>
+
+namespace {
+std::shared_ptr<slint::VectorModel<int>> rows(int count)
+{
+    std::vector<int> values(count);
+    std::iota(values.begin(), values.end(), 0);
+    return std::make_shared<slint::VectorModel<int>>(std::move(values));
+}
+}
+
+TEST_CASE("Repeater")
+{
+    for (int count : { 1'000, 10'000, 100'000 }) {
+        auto model = rows(count);
+        auto suffix = " (" + std::to_string(count) + " rows)";
+
+        BENCHMARK("Instantiate" + suffix)
+        {
+            auto ui = RepeaterBenchmark::create();
+            ui->set_model(model);
+            return ui->get_total_height();
+        };
+
+        // The instances stay and only the changed rows are updated
+        auto ui = RepeaterBenchmark::create();
+        ui->set_model(model);
+        ui->get_total_height();
+        int value = 0;
+        BENCHMARK("Update 100 rows" + suffix)
+        {
+            ++value;
+            for (int i = 0; i < count; i += count / 100) {
+                model->set_row_data(i, value);
+            }
+            return ui->get_total_height();
+        };
+    }
+}
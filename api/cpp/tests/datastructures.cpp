@@ -7,6 +7,7 @@
 
 #include <slint.h>
 #include <slint_image.h>
+#include <slint_platform.h>
 
 SCENARIO("SharedString API")
 {
@@ -54,6 +55,22 @@ TEST_CASE("Basic SharedVector API", "[vector]")
         REQUIRE(vec[1] == 4);
         REQUIRE(vec[2] == 10);
     }
+
+    SECTION("Sized")
+    {
+        slint::SharedVector<int> vec(3, 7);
+        REQUIRE(vec.size() == 3);
+        REQUIRE(vec[0] == 7);
+        REQUIRE(vec[2] == 7);
+        REQUIRE(slint::SharedVector<int>(2) == slint::SharedVector<int>({ 0, 0 }));
+    }
+
+    SECTION("Range")
+    {
+        std::vector<int> values { 5, 6, 8 };
+        slint::SharedVector<int> vec(values.begin(), values.end());
+        REQUIRE(vec == slint::SharedVector<int>({ 5, 6, 8 }));
+    }
 }
 
 TEST_CASE("Property Tracker")
@@ -132,21 +149,76 @@ TEST_CASE("Track model row data changes")
     }) == 100);
     REQUIRE(!tracker.is_dirty());
 
-    // Any changes to rows (even if after tracked rows) for now also marks watched rows as dirty, to
-    // keep the logic simple.
+    // Rows added or removed after the tracked row don't move it
     model->push_back(200);
-    REQUIRE(tracker.is_dirty());
+    REQUIRE(!tracker.is_dirty());
+    model->erase(5);
+    REQUIRE(!tracker.is_dirty());
 
+    model->insert(0, 255);
+    REQUIRE(tracker.is_dirty());
     REQUIRE(tracker.evaluate([&]() {
         model->track_row_data_changes(1);
         return model->row_data(1);
-    }) == 100);
+    }) == 0);
     REQUIRE(!tracker.is_dirty());
 
-    model->insert(0, 255);
+    model->erase(1);
     REQUIRE(tracker.is_dirty());
 }
 
+TEST_CASE("Bindings only depend on the model rows they read")
+{
+    using namespace slint::private_api;
+
+    auto model = std::make_shared<slint::VectorModel<int>>(std::vector<int> { 0, 1, 2, 3, 4 });
+
+    int evaluations[2] = { 0, 0 };
+    Property<int> rows[2];
+    for (int i : { 0, 1 }) {
+        rows[i].set_binding([&, i] {
+            ++evaluations[i];
+            return *model->row_data_tracked(i * 3);
+        });
+    }
+    auto get_rows = [&] { return std::vector<int> { rows[0].get(), rows[1].get() }; };
+    auto take_evaluations = [&] {
+        std::vector<int> result(std::begin(evaluations), std::end(evaluations));
+        evaluations[0] = evaluations[1] = 0;
+        return result;
+    };
+
+    REQUIRE(get_rows() == std::vector<int> { 0, 3 });
+    REQUIRE(take_evaluations() == std::vector<int> { 1, 1 });
+
+    model->set_row_data(3, 30);
+    REQUIRE(get_rows() == std::vector<int> { 0, 30 });
+    REQUIRE(take_evaluations() == std::vector<int> { 0, 1 });
+
+    model->set_row_data(1, 10);
+    model->set_row_data(4, 40);
+    REQUIRE(get_rows() == std::vector<int> { 0, 30 });
+    REQUIRE(take_evaluations() == std::vector<int> { 0, 0 });
+
+    // Inserting or removing before a row moves it
+    model->insert(2, 20);
+    REQUIRE(get_rows() == std::vector<int> { 0, 2 });
+    REQUIRE(take_evaluations() == std::vector<int> { 0, 1 });
+    model->erase(1);
+    REQUIRE(get_rows() == std::vector<int> { 0, 30 });
+    REQUIRE(take_evaluations() == std::vector<int> { 0, 1 });
+
+    model->push_back(50);
+    model->set_row_data(0, 100);
+    REQUIRE(get_rows() == std::vector<int> { 100, 30 });
+    REQUIRE(take_evaluations() == std::vector<int> { 1, 0 });
+
+    // A row is tracked again after it was invalidated
+    model->set_row_data(3, 300);
+    REQUIRE(get_rows() == std::vector<int> { 100, 300 });
+    REQUIRE(take_evaluations() == std::vector<int> { 0, 1 });
+}
+
 TEST_CASE("Image")
 {
     using namespace slint;
@@ -172,6 +244,81 @@ TEST_CASE("Image")
         REQUIRE(actual_path.has_value());
         REQUIRE(*actual_path == SOURCE_DIR "/../../logo/slint-logo-square-light-128x128.png");
     }
+
+    img = Image::decode_from_path(SOURCE_DIR "/../../logo/slint-logo-square-light-128x128.png");
+    REQUIRE(img.size() == Size<unsigned int> { 128, 128 });
+    REQUIRE(img.path().has_value());
+
+    img = Image::decode_from_path(SOURCE_DIR "/../../logo/slint-logo-square-light-128x128.png",
+                                  { 64, 32 });
+    REQUIRE(img.size() == Size<unsigned int> { 32, 32 });
+    REQUIRE(!img.path().has_value());
+
+    img = Image::decode_from_path(SOURCE_DIR "/../../logo/does-not-exist.png");
+    REQUIRE(img.size() == Size<unsigned int> { 0, 0 });
+}
+
+TEST_CASE("Image from pixel buffer")
+{
+    using namespace slint;
+
+    SharedPixelBuffer<Rgb8Pixel> rgb(320, 200);
+    REQUIRE(rgb.size() == 320 * 200);
+    Image img(rgb);
+    {
+        auto size = img.size();
+        REQUIRE(size.width == 320);
+        REQUIRE(size.height == 200);
+    }
+    REQUIRE(img == Image(rgb));
+    REQUIRE(img != Image(SharedPixelBuffer<Rgb8Pixel>(320, 200)));
+
+    // Alternating between two buffers writes the pixels in place once the image doesn't
+    // refer to a buffer anymore.
+    SharedPixelBuffer<Rgba8Pixel> frames[2] = { { 4, 2 }, { 4, 2 } };
+    const auto *front_pixels = std::as_const(frames[0]).begin();
+    const auto *back_pixels = std::as_const(frames[1]).begin();
+    Image frame = Image::create_from_premultiplied_rgba8(frames[0]);
+    frames[1].begin()[0] = Rgba8Pixel { 1, 2, 3, 4 };
+    REQUIRE(std::as_const(frames[1]).begin() == back_pixels);
+    frame = Image::create_from_premultiplied_rgba8(frames[1]);
+    frames[0].begin()[0] = Rgba8Pixel { 5, 6, 7, 8 };
+    REQUIRE(std::as_const(frames[0]).begin() == front_pixels);
+    REQUIRE(frame == Image::create_from_premultiplied_rgba8(frames[1]));
+    REQUIRE(frame != Image(frames[1]));
+
+    SharedVector<Rgba8Pixel> pixels(6, Rgba8Pixel { 10, 20, 30, 255 });
+    SharedPixelBuffer<Rgba8Pixel> adopted(3, 2, pixels);
+    REQUIRE(adopted.data().cbegin() == pixels.cbegin());
+    REQUIRE(adopted.begin()[5].a == 255);
+    REQUIRE(adopted.data().cbegin() != pixels.cbegin()); // still shared, so writing copied it
+
+    // A vector with too few pixels is extended to the size of the buffer
+    SharedPixelBuffer<Rgba8Pixel> short_data(3, 2, SharedVector<Rgba8Pixel>(4, Rgba8Pixel { 10, 20, 30, 255 }));
+    REQUIRE(short_data.size() == 6);
+    REQUIRE(short_data.begin()[3].a == 255);
+    REQUIRE(short_data.begin()[4].a == 0);
+}
+
+TEST_CASE("Image from borrowed OpenGL texture")
+{
+    using namespace slint;
+
+    auto img = Image::create_from_borrowed_gl_2d_rgba_texture(
+            42, { 64, 48 }, BorrowedOpenGLTextureOrigin::BottomLeft);
+    REQUIRE(img.size() == Size<unsigned int> { 64, 48 });
+    REQUIRE(!img.path().has_value());
+    REQUIRE(img
+            == Image::create_from_borrowed_gl_2d_rgba_texture(
+                    42, { 64, 48 }, BorrowedOpenGLTextureOrigin::BottomLeft));
+    REQUIRE(img
+            != Image::create_from_borrowed_gl_2d_rgba_texture(
+                    42, { 64, 48 }, BorrowedOpenGLTextureOrigin::TopLeft));
+
+    // 0 is not a texture
+    REQUIRE(Image::create_from_borrowed_gl_2d_rgba_texture(0, { 64, 48 },
+                                                          BorrowedOpenGLTextureOrigin::TopLeft)
+            == Image());
 }
 
 TEST_CASE("SharedVector")
@@ -202,3 +349,174 @@ TEST_CASE("SharedVector")
     copy.clear(); // copy is not shared (anymore), retain capacity.
     REQUIRE(copy.capacity() == orig_cap);
 }
+
+TEST_CASE("SharedVector growth and relocation")
+{
+    using namespace slint;
+
+    struct Counted
+    {
+        int value;
+        int *copies;
+        Counted(int value, int *copies) : value(value), copies(copies) { }
+        Counted(const Counted &other) : value(other.value), copies(other.copies) { ++*copies; }
+        Counted(Counted &&other) noexcept = default;
+        Counted &operator=(const Counted &other) = default;
+        Counted &operator=(Counted &&other) noexcept = default;
+    };
+
+    int copies = 0;
+    SharedVector<Counted> vec;
+    int reallocations = 0;
+    for (int i = 0; i < 1000; ++i) {
+        auto capacity = vec.capacity();
+        vec.emplace_back(i, &copies);
+        reallocations += vec.capacity() != capacity;
+    }
+    REQUIRE(vec.size() == 1000);
+    REQUIRE(vec[999].value == 999);
+    REQUIRE(reallocations < 15);
+    REQUIRE(copies == 0); // the elements were moved when growing
+
+    auto copy = vec;
+    vec.push_back(Counted(1000, &copies));
+    REQUIRE(copies == 1000); // shared, so copied
+    REQUIRE(copy.size() == 1000);
+    REQUIRE(vec.size() == 1001);
+
+    SharedVector<int> reserved;
+    reserved.reserve(100);
+    REQUIRE(reserved.capacity() == 100);
+    auto data = reserved.cbegin();
+    for (int i = 0; i < 100; ++i) {
+        reserved.push_back(i);
+    }
+    REQUIRE(reserved.cbegin() == data);
+}
+
+TEST_CASE("SharedVector modifiers")
+{
+    using namespace slint;
+
+    SharedVector<SharedString> vec { "a", "b", "c" };
+    auto copy = vec;
+
+    SECTION("resize")
+    {
+        vec.resize(5, "x");
+        REQUIRE(vec == SharedVector<SharedString> { "a", "b", "c", "x", "x" });
+        vec.resize(2);
+        REQUIRE(vec == SharedVector<SharedString> { "a", "b" });
+        vec.resize(3);
+        REQUIRE(vec == SharedVector<SharedString> { "a", "b", "" });
+    }
+
+    SECTION("insert")
+    {
+        auto it = vec.insert(vec.cbegin() + 1, "x");
+        REQUIRE(*it == "x");
+        REQUIRE(vec == SharedVector<SharedString> { "a", "x", "b", "c" });
+        std::vector<SharedString> range { "y", "z" };
+        vec.insert(vec.cend(), range.begin(), range.end());
+        REQUIRE(vec == SharedVector<SharedString> { "a", "x", "b", "c", "y", "z" });
+        vec.insert(vec.cbegin(), vec.cbegin() + 4, vec.cend());
+        REQUIRE(vec == SharedVector<SharedString> { "y", "z", "a", "x", "b", "c", "y", "z" });
+        vec.insert(vec.cbegin(), vec[2]);
+        REQUIRE(vec[0] == "a");
+    }
+
+    SECTION("erase")
+    {
+        auto it = vec.erase(vec.cbegin());
+        REQUIRE(*it == "b");
+        REQUIRE(vec == SharedVector<SharedString> { "b", "c" });
+        vec.push_back("d");
+        vec.erase(vec.cbegin() + 1, vec.cend());
+        REQUIRE(vec == SharedVector<SharedString> { "b" });
+    }
+
+    REQUIRE(copy == SharedVector<SharedString> { "a", "b", "c" });
+}
+
+TEST_CASE("SharedVector allocator can't be replaced after allocating")
+{
+    struct Allocator : slint::platform::Allocator
+    {
+        bool *destroyed;
+        explicit Allocator(bool *destroyed) : destroyed(destroyed) { }
+        ~Allocator() { *destroyed = true; }
+        void *allocate(std::size_t size, std::size_t align) override
+        {
+            return ::operator new(size, std::align_val_t(align));
+        }
+        void deallocate(void *ptr, std::size_t, std::size_t align) override
+        {
+            ::operator delete(ptr, std::align_val_t(align));
+        }
+    };
+
+    slint::SharedVector<int> vec { 1, 2, 3 };
+    bool destroyed = false;
+    REQUIRE(!slint::platform::Allocator::set_allocator(std::make_unique<Allocator>(&destroyed)));
+    REQUIRE(destroyed);
+}
+
+TEST_CASE("SharedStringBuilder and SharedStringInterner")
+{
+    using namespace slint;
+
+    SharedStringBuilder builder;
+    builder.append("x = ").append_number(12.5).append(", y = ").append_number(2, 2);
+    REQUIRE(builder.view() == "x = 12.5, y = 2.00");
+    auto first = builder.freeze();
+    REQUIRE(first == "x = 12.5, y = 2.00");
+    REQUIRE(builder.view() == "");
+    auto second = builder.append_number(42).append(" ms").freeze();
+    REQUIRE(second == "42 ms");
+    REQUIRE(first == "x = 12.5, y = 2.00");
+
+    SharedStringInterner interner;
+    auto ok = interner.intern("OK");
+    REQUIRE(ok == "OK");
+    REQUIRE(interner.intern("OK").data() == ok.data());
+    interner.intern("Cancel");
+    REQUIRE(interner.size() == 2);
+    interner.clear();
+    REQUIRE(interner.size() == 0);
+    REQUIRE(ok == "OK");
+}
+
+TEST_CASE("PathData polylines")
+{
+    using namespace slint::private_api;
+    using slint::SharedVector;
+
+    SECTION("append to an open sub-path")
+    {
+        PathData path(SharedVector<PathEvent> { PathEvent::Begin, PathEvent::Line,
+                                                PathEvent::EndOpen },
+                      SharedVector<Point> { { 0, 0 }, { 0, 0 }, { 1, 1 } });
+        Point next[] = { { 2, 0 } };
+        path.append_polyline(next);
+        REQUIRE(path
+                == PathData(SharedVector<PathEvent> { PathEvent::Begin, PathEvent::Line,
+                                                      PathEvent::Line, PathEvent::EndOpen },
+                            SharedVector<Point> { { 0, 0 }, { 0, 0 }, { 1, 1 }, { 1, 1 },
+                                                  { 2, 0 } }));
+    }
+
+    SECTION("decimate to the min/max of each column")
+    {
+        Point points[] = { { -1, 0 },  { 0, 1 },   { 0.2, 3 }, { 0.4, 2 }, { 0.5, -1 },
+                           { 0.6, 0 }, { 0.8, 2 }, { 1.2, 0 }, { 1.5, 4 }, { 1.9, 1 },
+                           { 2.5, 0 }, { 3, 5 } };
+        // The first, highest, lowest and last points of each of the two columns, and the
+        // nearest point outside of the range on each side
+        Point kept[] = { { -1, 0 },  { 0, 1 },   { 0.2, 3 }, { 0.5, -1 }, { 0.8, 2 },
+                         { 1.2, 0 }, { 1.5, 4 }, { 1.9, 1 }, { 2.5, 0 } };
+        PathData expected;
+        expected.append_polyline(kept);
+        REQUIRE(PathData::decimated_polyline(points, 0, 2, 2) == expected);
+        REQUIRE(PathData::decimated_polyline(points, 0, 2, 0) == PathData());
+    }
+}
@@ -5,6 +5,7 @@
 #include "catch2/catch.hpp"
 
 #include <slint.h>
+#include <slint_platform.h>
 #include <thread>
 
 TEST_CASE("C++ Singleshot Timers")
@@ -176,3 +177,300 @@ TEST_CASE("Blocking Event from thread")
     REQUIRE(called == 42);
     t.join();
 }
+
+TEST_CASE("Update channel coalesces values")
+{
+    std::vector<std::pair<std::size_t, int>> handled;
+    slint::UpdateChannel<int> channel(3, [&](std::size_t key, int value) {
+        handled.emplace_back(key, value);
+    });
+
+    channel.post(2, 1);
+    channel.post(0, 2);
+    channel.post(2, 3);
+    channel.post(2, 4);
+    slint::invoke_from_event_loop([&] {
+        REQUIRE(handled == std::vector<std::pair<std::size_t, int>> { { 2, 4 }, { 0, 2 } });
+        channel.post(0, 5);
+        slint::invoke_from_event_loop([] { slint::quit_event_loop(); });
+    });
+
+    slint::run_event_loop();
+    REQUIRE(handled == std::vector<std::pair<std::size_t, int>> { { 2, 4 }, { 0, 2 }, { 0, 5 } });
+}
+
+TEST_CASE("Update channel with a small pool")
+{
+    std::vector<std::pair<std::size_t, int>> handled;
+    // The pool is grown to hold a node for each key, so posting from the event loop thread
+    // doesn't wait forever for a node
+    slint::UpdateChannel<int> channel(
+            3, [&](std::size_t key, int value) { handled.emplace_back(key, value); }, 1);
+
+    slint::invoke_from_event_loop([&] {
+        for (int i = 0; i < 3; ++i) {
+            channel.post(0, i);
+            channel.post(1, i);
+            channel.post(2, i);
+        }
+        channel.post(3, 42);
+        slint::invoke_from_event_loop([] { slint::quit_event_loop(); });
+    });
+
+    slint::run_event_loop();
+    REQUIRE(handled == std::vector<std::pair<std::size_t, int>> { { 0, 2 }, { 1, 2 }, { 2, 2 } });
+}
+
+TEST_CASE("Update channel from threads")
+{
+    constexpr std::size_t key_count = 4;
+    constexpr int update_count = 10000;
+    std::vector<int> latest(key_count, 0);
+    int handled = 0;
+    bool in_order = true;
+    // A pool barely larger than the key count, to exercise producers waiting for free nodes
+    slint::UpdateChannel<std::unique_ptr<int>> channel(
+            key_count,
+            [&](std::size_t key, std::unique_ptr<int> value) {
+                in_order = in_order && *value > latest[key];
+                latest[key] = *value;
+                handled++;
+            },
+            key_count + 1);
+
+    std::vector<std::thread> producers;
+    for (std::size_t key = 0; key < key_count; ++key) {
+        producers.emplace_back([=] {
+            for (int i = 1; i <= update_count; ++i) {
+                channel.post(key, std::make_unique<int>(i));
+            }
+        });
+    }
+    auto t = std::thread([&] {
+        for (auto &producer : producers) {
+            producer.join();
+        }
+        slint::invoke_from_event_loop([] { slint::quit_event_loop(); });
+    });
+
+    slint::run_event_loop();
+    t.join();
+    REQUIRE(in_order);
+    REQUIRE(latest == std::vector<int>(key_count, update_count));
+    REQUIRE(handled <= int(key_count) * update_count);
+}
+
+TEST_CASE("Update channel created by a thread without event loop")
+{
+    constexpr int update_count = 10000;
+    auto main_thread = std::this_thread::get_id();
+    bool on_main_thread = true;
+    std::vector<int> latest(2, 0);
+
+    auto t = std::thread([&] {
+        // The creating thread doesn't run an event loop: when the pool is exhausted, its posts
+        // wait for the main event loop instead of handling the values themselves
+        slint::UpdateChannel<int> channel(
+                2,
+                [&](std::size_t key, int value) {
+                    on_main_thread = on_main_thread && std::this_thread::get_id() == main_thread;
+                    latest[key] = value;
+                },
+                3);
+        auto producer = std::thread([=] {
+            for (int i = 1; i <= update_count; ++i) {
+                channel.post(1, i);
+            }
+        });
+        for (int i = 1; i <= update_count; ++i) {
+            channel.post(0, i);
+        }
+        producer.join();
+        slint::invoke_from_event_loop([] { slint::quit_event_loop(); });
+    });
+
+    slint::run_event_loop();
+    t.join();
+    REQUIRE(on_main_thread);
+    REQUIRE(latest == std::vector<int>(2, update_count));
+}
+
+TEST_CASE("Async event from thread")
+{
+    std::atomic<int> called = 0;
+    std::atomic<bool> threw = false;
+    auto t = std::thread([&] {
+        auto foo = slint::async_invoke_from_event_loop([&] { return std::make_unique<int>(42); });
+        auto failed = slint::async_invoke_from_event_loop([]() -> int {
+            throw std::runtime_error("failed");
+        });
+        called = *foo.get();
+        try {
+            failed.get();
+        } catch (const std::runtime_error &) {
+            threw = true;
+        }
+        slint::async_invoke_from_event_loop([] { slint::quit_event_loop(); }).wait();
+    });
+
+    slint::run_event_loop();
+    t.join();
+    REQUIRE(called == 42);
+    REQUIRE(threw);
+}
+
+TEST_CASE("Load image asynchronously")
+{
+    auto main_thread = std::this_thread::get_id();
+    std::vector<slint::Image> images;
+    bool on_main_thread = true;
+    for (int i = 0; i < 4; ++i) {
+        slint::load_image_from_path_async(
+                SOURCE_DIR "/../../logo/slint-logo-square-light-128x128.png",
+                [&](slint::Image image) {
+                    on_main_thread = on_main_thread && std::this_thread::get_id() == main_thread;
+                    images.push_back(image);
+                    if (images.size() == 4) {
+                        slint::quit_event_loop();
+                    }
+                },
+                { 16, 16 });
+    }
+
+    slint::run_event_loop();
+    REQUIRE(on_main_thread);
+    for (const auto &image : images) {
+        REQUIRE(image.size() == slint::Size<unsigned int> { 16, 16 });
+    }
+}
+
+namespace {
+/// A platform whose event loop runs the tasks of a queue
+struct QueuePlatform : slint::platform::Platform
+{
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<Task> tasks;
+    bool quit = false;
+
+    std::shared_ptr<slint::platform::SoftwareWindow> create_window_adapter() override
+    {
+        return std::make_shared<slint::platform::SoftwareWindow>();
+    }
+
+    void run_event_loop() override
+    {
+        while (true) {
+            std::unique_lock lock(mutex);
+            cv.wait(lock, [&] { return quit || !tasks.empty(); });
+            if (quit) {
+                return;
+            }
+            auto task = std::move(tasks.front());
+            tasks.pop_front();
+            lock.unlock();
+            std::move(task).run();
+        }
+    }
+
+    void quit_event_loop() override
+    {
+        std::lock_guard lock(mutex);
+        quit = true;
+        cv.notify_one();
+    }
+
+    void invoke_from_event_loop(Task task) override
+    {
+        std::lock_guard lock(mutex);
+        tasks.push_back(std::move(task));
+        cv.notify_one();
+    }
+};
+}
+
+TEST_CASE("Event loops on several threads")
+{
+    std::vector<std::thread> threads;
+    std::vector<slint::EventLoopContext> contexts;
+    for (int i = 0; i < 2; ++i) {
+        std::promise<slint::EventLoopContext> context;
+        auto future = context.get_future();
+        threads.emplace_back([context = std::move(context)]() mutable {
+            slint::platform::Platform::set_thread_platform(std::make_unique<QueuePlatform>());
+            context.set_value(*slint::EventLoopContext::current());
+            slint::run_event_loop();
+        });
+        contexts.push_back(future.get());
+    }
+
+    std::mutex mutex;
+    std::vector<std::pair<int, std::thread::id>> invoked;
+    for (int i = 0; i < 2; ++i) {
+        REQUIRE(contexts[i].invoke_from_event_loop([&, i] {
+            // A channel created in this thread is handled by its event loop, not the main one
+            slint::UpdateChannel<int> channel(1, [&, i](std::size_t, int) {
+                std::lock_guard lock(mutex);
+                invoked.emplace_back(i, std::this_thread::get_id());
+                // Quits the event loop of this thread only
+                slint::quit_event_loop();
+            });
+            std::thread([channel] { channel.post(0, 0); }).join();
+        }));
+    }
+
+    std::vector<std::pair<int, std::thread::id>> expected;
+    for (int i = 0; i < 2; ++i) {
+        expected.emplace_back(i, threads[i].get_id());
+        threads[i].join();
+    }
+    std::sort(invoked.begin(), invoked.end());
+    REQUIRE(invoked == expected);
+
+    // The platform of a thread is destroyed with it
+    int destroyed = 0;
+    auto count_destruction = std::shared_ptr<void>(nullptr, [&](void *) { ++destroyed; });
+    REQUIRE(!contexts[0].invoke_from_event_loop([count_destruction] { }));
+    count_destruction.reset();
+    REQUIRE(destroyed == 1);
+    REQUIRE(!contexts[1].quit_event_loop());
+}
+
+#if defined(__cpp_impl_coroutine)
+namespace {
+struct DetachedTask
+{
+    struct promise_type
+    {
+        DetachedTask get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() { }
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+}
+
+TEST_CASE("Resume coroutine on event loop")
+{
+    auto main_thread = std::this_thread::get_id();
+    std::thread worker;
+    auto on_worker = [&](auto resume) { worker = std::thread(std::move(resume)); };
+    std::vector<std::thread::id> threads;
+
+    auto coroutine = [&]() -> DetachedTask {
+        co_await slint::resume_on(on_worker);
+        threads.push_back(std::this_thread::get_id());
+        co_await slint::resume_on_event_loop();
+        threads.push_back(std::this_thread::get_id());
+        slint::quit_event_loop();
+    };
+    coroutine();
+
+    slint::run_event_loop();
+    worker.join();
+    REQUIRE(threads.size() == 2);
+    REQUIRE(threads[0] != main_thread);
+    REQUIRE(threads[1] == main_thread);
+}
+#endif
@@ -387,6 +387,109 @@ SCENARIO("Invoke callback")
     }
 }
 
+SCENARIO("Property and callback handles")
+{
+    using namespace slint::interpreter;
+    using namespace slint;
+
+    ComponentCompiler compiler;
+    auto comp_def = *compiler.build_from_source(
+            "export Dummy := Rectangle { property <string> test; property <int> test-alias <=> "
+            "sub_object.value; callback concat(string, string) -> string; "
+            "property <string> label-text <=> label.text; "
+            "sub_object := Rectangle { property <int> value; } label := Text { } }",
+            "");
+    auto instance = comp_def.create();
+
+    SECTION("properties")
+    {
+        auto test = comp_def.property_handle("test");
+        REQUIRE(test.has_value());
+        REQUIRE(test->type() == Value::Type::String);
+        REQUIRE(instance->set_property(*test, SharedString("Hello")));
+        REQUIRE(*instance->get_property(*test)->to_string() == SharedString("Hello"));
+        REQUIRE(*instance->get_property("test")->to_string() == SharedString("Hello"));
+        REQUIRE(!instance->set_property(*test, Value(42.)));
+
+        auto alias = comp_def.property_handle("test_alias");
+        REQUIRE(alias.has_value());
+        REQUIRE(alias->type() == Value::Type::Number);
+        REQUIRE(instance->set_property(*alias, Value(42.)));
+        REQUIRE(*instance->get_property("test-alias")->to_number() == 42.);
+
+        auto label_text = comp_def.property_handle("label-text");
+        REQUIRE(label_text.has_value());
+        REQUIRE(instance->set_property(*label_text, SharedString("Label")));
+        REQUIRE(*instance->get_property("label-text")->to_string() == SharedString("Label"));
+        REQUIRE(*instance->get_property(*label_text)->to_string() == SharedString("Label"));
+
+        REQUIRE(!comp_def.property_handle("does_not_exist").has_value());
+        REQUIRE(!comp_def.property_handle("concat").has_value());
+    }
+
+    SECTION("callbacks")
+    {
+        REQUIRE(instance->set_callback("concat", [](auto args) {
+            return Value(SharedString(std::string(*args[0].to_string())
+                                      + std::string(*args[1].to_string())));
+        }));
+        auto concat = comp_def.callback_handle("concat");
+        REQUIRE(concat.has_value());
+        Value args[] = { SharedString("Hello"), SharedString("World") };
+        auto res = instance->invoke_callback(*concat, args);
+        REQUIRE(res.has_value());
+        REQUIRE(*res->to_string() == SharedString("HelloWorld"));
+
+        REQUIRE(!comp_def.callback_handle("test").has_value());
+    }
+
+    SECTION("other definition")
+    {
+        auto other_def = *compiler.build_from_source(
+                "export Other := Rectangle { property <string> test; }", "");
+        auto test = other_def.property_handle("test");
+        REQUIRE(test.has_value());
+        REQUIRE(!instance->set_property(*test, SharedString("Hello")));
+        REQUIRE(!instance->get_property(*test).has_value());
+    }
+}
+
+SCENARIO("Set properties in a batch")
+{
+    using namespace slint::interpreter;
+    using namespace slint;
+
+    ComponentCompiler compiler;
+    auto comp_def = *compiler.build_from_source(
+            R"(
+        export global Settings := {
+            property <string> unit;
+            property <int> precision;
+        }
+        export Dummy := Rectangle {
+            property <string> name;
+            property <int> value;
+            property <string> summary: name + ": " + value + Settings.unit;
+        }
+    )",
+            "");
+    auto instance = comp_def.create();
+    auto value = *comp_def.property_handle("value");
+
+    PropertyUpdate updates[] = { { "name", SharedString("Speed") }, { value, Value(42.) } };
+    REQUIRE(instance->set_properties(updates));
+    PropertyUpdate global_updates[] = { { "unit", SharedString("km/h") }, { "precision", 2. } };
+    REQUIRE(instance->set_global_properties("Settings", global_updates));
+    REQUIRE(*instance->get_property("summary")->to_string() == SharedString("Speed: 42km/h"));
+    REQUIRE(*instance->get_global_property("Settings", "precision")->to_number() == 2.);
+
+    // An invalid update does not prevent the others from being applied
+    PropertyUpdate invalid_updates[] = { { "name", Value(1.) }, { "value", Value(43.) } };
+    REQUIRE(!instance->set_properties(invalid_updates));
+    REQUIRE(*instance->get_property("summary")->to_string() == SharedString("Speed: 43km/h"));
+    REQUIRE(!instance->set_global_properties("DoesNotExist", global_updates));
+}
+
 SCENARIO("Array between .slint and C++")
 {
     using namespace slint::interpreter;
@@ -421,6 +524,27 @@ SCENARIO("Array between .slint and C++")
         auto actual_array = *maybe_array;
         REQUIRE(actual_array.to_array() == cpp_array);
     }
+
+    SECTION("Numbers between .slint and C++")
+    {
+        REQUIRE(instance->get_property("array")->to_number_array<int32_t>()
+                == slint::SharedVector<int32_t> { 1, 2, 3 });
+        REQUIRE(!Value(true).to_number_array<double>().has_value());
+
+        slint::SharedVector<float> samples { 4.5, 5.5, 6.5 };
+        instance->set_property("array", Value(samples));
+        auto numbers = instance->get_property("array")->to_number_array<float>();
+        REQUIRE(numbers == samples);
+        // the buffer is shared with the model
+        REQUIRE(numbers->cbegin() == samples.cbegin());
+        REQUIRE(instance->get_property("array")->to_array()
+                == slint::SharedVector<Value> { Value(4.5), Value(5.5), Value(6.5) });
+
+        std::vector<double> vector { 7., 8. };
+        instance->set_property("array", Value(std::span<const double>(vector)));
+        REQUIRE(instance->get_property("array")->to_number_array<double>()
+                == slint::SharedVector<double> { 7., 8. });
+    }
 }
 
 SCENARIO("Angle between .slint and C++")
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-Slint-commercial
 
 #include <chrono>
+#include <stdexcept>
 #define CATCH_CONFIG_MAIN
 #include "catch2/catch.hpp"
 
@@ -11,6 +12,11 @@ struct ModelObserver : public slint::private_api::ModelChangeListener
 {
     void row_added(int index, int count) override { added_rows.push_back(Range { index, count }); }
     void row_changed(int index) override { changed_rows.push_back(index); }
+    void rows_changed(int index, int count) override
+    {
+        changed_ranges.push_back(Range { index, count });
+        ModelChangeListener::rows_changed(index, count);
+    }
     void row_removed(int index, int count) override
     {
         removed_rows.push_back(Range { index, count });
@@ -21,6 +27,7 @@ struct ModelObserver : public slint::private_api::ModelChangeListener
     {
         added_rows.clear();
         changed_rows.clear();
+        changed_ranges.clear();
         removed_rows.clear();
         model_reset = false;
     }
@@ -34,6 +41,7 @@ struct ModelObserver : public slint::private_api::ModelChangeListener
     };
     std::vector<Range> added_rows;
     std::vector<int> changed_rows;
+    std::vector<Range> changed_ranges;
     std::vector<Range> removed_rows;
     bool model_reset = false;
 };
@@ -173,6 +181,181 @@ SCENARIO("Filtering Change")
     REQUIRE(even_rows->row_data(2) == 0);
 }
 
+// A model that reports blocks of modified rows with a single notification
+struct RangeModel : public slint::Model<int>
+{
+    RangeModel(std::vector<int> data) : data(std::move(data)) { }
+    int row_count() const override { return int(data.size()); }
+    std::optional<int> row_data(int i) const override
+    {
+        if (i >= row_count())
+            return {};
+        return data[i];
+    }
+    void set_rows(int index, const std::vector<int> &values)
+    {
+        std::copy(values.begin(), values.end(), data.begin() + index);
+        rows_changed(index, int(values.size()));
+    }
+    std::vector<int> data;
+};
+
+SCENARIO("Filtering Range Change")
+{
+    auto range_model = std::make_shared<RangeModel>(std::vector<int> { 2, 4, 6, 1, 8 });
+
+    auto even_rows = std::make_shared<slint::FilterModel<int>>(
+            range_model, [](auto value) { return value % 2 == 0; });
+
+    auto observer = std::make_shared<ModelObserver>();
+    even_rows->attach_peer(observer);
+
+    REQUIRE(even_rows->row_count() == 4);
+
+    // all accepted rows stay accepted -> a single range notification
+    range_model->set_rows(0, { 10, 12, 14, 3, 16 });
+
+    REQUIRE(observer->added_rows.empty());
+    REQUIRE(observer->changed_ranges.size() == 1);
+    REQUIRE(observer->changed_ranges[0] == ModelObserver::Range { 0, 4 });
+    REQUIRE(observer->removed_rows.empty());
+    REQUIRE(!observer->model_reset);
+    observer->clear();
+
+    REQUIRE(even_rows->row_count() == 4);
+    REQUIRE(even_rows->row_data(0) == 10);
+    REQUIRE(even_rows->row_data(3) == 16);
+
+    // rows that are no longer accepted are removed, newly accepted ones are added
+    range_model->set_rows(1, { 1, 1, 4 });
+
+    REQUIRE(observer->added_rows.size() == 1);
+    REQUIRE(observer->added_rows[0] == ModelObserver::Range { 1, 1 });
+    REQUIRE(observer->changed_ranges.empty());
+    REQUIRE(observer->removed_rows.size() == 2);
+    REQUIRE(observer->removed_rows[0] == ModelObserver::Range { 1, 1 });
+    REQUIRE(observer->removed_rows[1] == ModelObserver::Range { 1, 1 });
+    REQUIRE(!observer->model_reset);
+    observer->clear();
+
+    REQUIRE(even_rows->row_count() == 3);
+    REQUIRE(even_rows->row_data(0) == 10);
+    REQUIRE(even_rows->row_data(1) == 4);
+    REQUIRE(even_rows->row_data(2) == 16);
+}
+
+SCENARIO("Filtering Refilter")
+{
+    auto vec_model = std::make_shared<slint::VectorModel<int>>(
+            std::vector<int> { 1, 2, 3, 4, 5, 6, 7, 8 });
+
+    int divisor = 2;
+    auto filtered = std::make_shared<slint::FilterModel<int>>(
+            vec_model, [&divisor](auto value) { return value % divisor == 0; });
+
+    auto observer = std::make_shared<ModelObserver>();
+    filtered->attach_peer(observer);
+
+    REQUIRE(filtered->row_count() == 4);
+
+    // 2, 4, 6, 8 -> 4, 8: only the rejected rows are removed
+    divisor = 4;
+    filtered->reset();
+
+    REQUIRE(observer->added_rows.empty());
+    REQUIRE(observer->removed_rows.size() == 2);
+    REQUIRE(observer->removed_rows[0] == ModelObserver::Range { 0, 1 });
+    REQUIRE(observer->removed_rows[1] == ModelObserver::Range { 1, 1 });
+    REQUIRE(!observer->model_reset);
+    observer->clear();
+
+    REQUIRE(filtered->row_count() == 2);
+    REQUIRE(filtered->row_data(0) == 4);
+    REQUIRE(filtered->row_data(1) == 8);
+
+    // 4, 8 -> 3, 6: rows are added and removed
+    divisor = 3;
+    filtered->reset();
+
+    REQUIRE(observer->added_rows.size() == 2);
+    REQUIRE(observer->added_rows[0] == ModelObserver::Range { 0, 1 });
+    REQUIRE(observer->added_rows[1] == ModelObserver::Range { 1, 1 });
+    REQUIRE(observer->removed_rows.size() == 2);
+    REQUIRE(observer->removed_rows[0] == ModelObserver::Range { 1, 1 });
+    REQUIRE(observer->removed_rows[1] == ModelObserver::Range { 2, 1 });
+    REQUIRE(!observer->model_reset);
+    observer->clear();
+
+    REQUIRE(filtered->row_count() == 2);
+    REQUIRE(filtered->row_data(0) == 3);
+    REQUIRE(filtered->row_data(1) == 6);
+
+    // 3, 6 -> all rows: a single range is added around each old row
+    divisor = 1;
+    filtered->reset();
+
+    REQUIRE(observer->added_rows.size() == 3);
+    REQUIRE(observer->added_rows[0] == ModelObserver::Range { 0, 2 });
+    REQUIRE(observer->added_rows[1] == ModelObserver::Range { 3, 2 });
+    REQUIRE(observer->added_rows[2] == ModelObserver::Range { 6, 2 });
+    REQUIRE(observer->removed_rows.empty());
+    observer->clear();
+
+    REQUIRE(filtered->row_count() == 8);
+    for (int i = 0; i < 8; ++i) {
+        REQUIRE(filtered->row_data(i) == i + 1);
+    }
+}
+
+SCENARIO("Filtering With Threads")
+{
+    std::vector<int> values(100000);
+    for (int i = 0; i < int(values.size()); ++i) {
+        values[i] = i;
+    }
+    auto vec_model = std::make_shared<slint::VectorModel<int>>(values);
+
+    int divisor = 3;
+    auto filtered = std::make_shared<slint::FilterModel<int>>(
+            vec_model, [&divisor](auto value) { return value % divisor == 0; });
+    filtered->set_filter_thread_count(4);
+
+    divisor = 7;
+    filtered->reset();
+
+    REQUIRE(filtered->row_count() == 14286);
+    bool all_rows_match = true;
+    for (int i = 0; i < filtered->row_count(); ++i) {
+        all_rows_match &= filtered->unfiltered_row(i) == i * 7;
+    }
+    REQUIRE(all_rows_match);
+
+    // An exception of the filter function in any of the threads is propagated to the caller
+    // and leaves the previous rows in place.
+    int throwing_row = -1;
+    filtered = std::make_shared<slint::FilterModel<int>>(vec_model, [&](auto value) {
+        if (value == throwing_row) {
+            throw std::runtime_error("filter failed");
+        }
+        return value % divisor == 0;
+    });
+    filtered->set_filter_thread_count(4);
+    REQUIRE(filtered->row_count() == 14286);
+
+    divisor = 3;
+    throwing_row = 90000;
+    REQUIRE_THROWS_AS(filtered->reset(), std::runtime_error);
+    REQUIRE(filtered->row_count() == 14286);
+
+    throwing_row = 10;
+    REQUIRE_THROWS_AS(filtered->reset(), std::runtime_error);
+    REQUIRE(filtered->row_count() == 14286);
+
+    throwing_row = -1;
+    filtered->reset();
+    REQUIRE(filtered->row_count() == 33334);
+}
+
 SCENARIO("Filtering Model Remove")
 {
     auto vec_model =
@@ -282,6 +465,55 @@ SCENARIO("Mapped Model")
     REQUIRE(plus_one_model->row_data(3) == 5);
 }
 
+SCENARIO("Mapped Model Cache")
+{
+    auto vec_model = std::make_shared<slint::VectorModel<int>>(std::vector<int> { 1, 2, 3, 4 });
+
+    int map_calls = 0;
+    auto mapped_model = std::make_shared<slint::MapModel<int, std::string>>(
+            vec_model, [&map_calls](auto value) {
+                ++map_calls;
+                return std::to_string(value);
+            });
+    mapped_model->set_cache_capacity(3);
+
+    auto mapped_rows = [&] {
+        std::vector<std::string> result;
+        for (int i = 0; i < mapped_model->row_count(); ++i) {
+            result.push_back(*mapped_model->row_data(i));
+        }
+        return result;
+    };
+
+    REQUIRE(mapped_model->row_data(1) == "2");
+    REQUIRE(mapped_model->row_data(1) == "2");
+    REQUIRE(map_calls == 1);
+
+    // The row is mapped again after a change
+    vec_model->set_row_data(1, 20);
+    REQUIRE(mapped_model->row_data(1) == "20");
+    REQUIRE(map_calls == 2);
+
+    // Cached rows are shifted by insertions and removals
+    mapped_model->row_data(2);
+    map_calls = 0;
+    vec_model->insert(0, 10);
+    REQUIRE(mapped_model->row_data(2) == "20");
+    REQUIRE(mapped_model->row_data(3) == "3");
+    REQUIRE(map_calls == 0);
+    vec_model->erase(1);
+    REQUIRE(mapped_model->row_data(1) == "20");
+    REQUIRE(mapped_model->row_data(2) == "3");
+    REQUIRE(map_calls == 0);
+
+    // At most three rows are cached, the least recently used one gets evicted
+    REQUIRE(mapped_rows() == std::vector<std::string> { "10", "20", "3", "4" });
+    map_calls = 0;
+    REQUIRE(mapped_model->row_data(3) == "4");
+    REQUIRE(mapped_model->row_data(0) == "10");
+    REQUIRE(map_calls == 1);
+}
+
 SCENARIO("Sorted Model Insert")
 {
     auto vec_model = std::make_shared<slint::VectorModel<int>>(std::vector<int> { 3, 4, 1, 2 });
@@ -396,3 +628,267 @@ SCENARIO("Sorted Model Change")
     REQUIRE(sorted_model->row_data(2) == 2);
     REQUIRE(sorted_model->row_data(3) == 3);
 }
+
+SCENARIO("Sorted By Key Model")
+{
+    struct Entry
+    {
+        std::string name;
+        int value;
+    };
+    auto vec_model = std::make_shared<slint::VectorModel<Entry>>(std::vector<Entry> {
+            { "c", 3 }, { "d", 4 }, { "a", 1 }, { "b", 2 } });
+
+    auto sorted_model = std::make_shared<slint::SortByKeyModel<Entry, std::string>>(
+            vec_model, [](const Entry &entry) { return entry.name; });
+
+    auto observer = std::make_shared<ModelObserver>();
+    sorted_model->attach_peer(observer);
+
+    auto values = [&] {
+        std::vector<int> result;
+        for (int i = 0; i < sorted_model->row_count(); ++i) {
+            result.push_back(sorted_model->row_data(i)->value);
+        }
+        return result;
+    };
+
+    REQUIRE(values() == std::vector<int> { 1, 2, 3, 4 });
+
+    /// Insert entries next to each other in the sorted order -> one range
+    vec_model->insert(0, { "bb", 5 });
+
+    REQUIRE(observer->added_rows.size() == 1);
+    REQUIRE(observer->added_rows[0] == ModelObserver::Range { 2, 1 });
+    REQUIRE(observer->removed_rows.empty());
+    observer->clear();
+    REQUIRE(values() == std::vector<int> { 1, 2, 5, 3, 4 });
+
+    /// Change the value but not the key -> maintain order
+    vec_model->set_row_data(0, { "bb", 6 });
+
+    REQUIRE(observer->added_rows.empty());
+    REQUIRE(observer->changed_rows == std::vector<int> { 2 });
+    REQUIRE(observer->removed_rows.empty());
+    observer->clear();
+    REQUIRE(values() == std::vector<int> { 1, 2, 6, 3, 4 });
+
+    /// Change the key -> new order with remove and insert
+    vec_model->set_row_data(0, { "e", 7 });
+
+    REQUIRE(observer->added_rows.size() == 1);
+    REQUIRE(observer->added_rows[0] == ModelObserver::Range { 4, 1 });
+    REQUIRE(observer->changed_rows.empty());
+    REQUIRE(observer->removed_rows.size() == 1);
+    REQUIRE(observer->removed_rows[0] == ModelObserver::Range { 2, 1 });
+    observer->clear();
+    REQUIRE(values() == std::vector<int> { 1, 2, 3, 4, 7 });
+
+    /// Remove the entries "c" and "e"
+    vec_model->erase(1);
+    vec_model->erase(0);
+
+    REQUIRE(observer->added_rows.empty());
+    REQUIRE(observer->changed_rows.empty());
+    REQUIRE(observer->removed_rows.size() == 2);
+    REQUIRE(observer->removed_rows[0] == ModelObserver::Range { 2, 1 });
+    REQUIRE(observer->removed_rows[1] == ModelObserver::Range { 3, 1 });
+    REQUIRE(!observer->model_reset);
+    observer->clear();
+    REQUIRE(values() == std::vector<int> { 1, 2, 4 });
+    REQUIRE(sorted_model->unsorted_row(0) == 1);
+}
+
+SCENARIO("Sorted By Key Model Equal Keys")
+{
+    auto range_model = std::make_shared<RangeModel>(std::vector<int> { 10, 20, 11, 21, 12 });
+
+    auto sorted_model = std::make_shared<slint::SortByKeyModel<int, int>>(
+            range_model, [](int value) { return value / 10; });
+
+    auto observer = std::make_shared<ModelObserver>();
+    sorted_model->attach_peer(observer);
+
+    // Rows with equal keys keep the order of the source model
+    REQUIRE(sorted_model->row_data(0) == 10);
+    REQUIRE(sorted_model->row_data(1) == 11);
+    REQUIRE(sorted_model->row_data(2) == 12);
+    REQUIRE(sorted_model->row_data(3) == 20);
+    REQUIRE(sorted_model->row_data(4) == 21);
+
+    // Changes that keep the keys are notified as ranges
+    range_model->set_rows(2, { 13, 22, 14 });
+
+    REQUIRE(observer->added_rows.empty());
+    REQUIRE(observer->changed_ranges.size() == 3);
+    REQUIRE(observer->changed_ranges[0] == ModelObserver::Range { 1, 1 });
+    REQUIRE(observer->changed_ranges[1] == ModelObserver::Range { 4, 1 });
+    REQUIRE(observer->changed_ranges[2] == ModelObserver::Range { 2, 1 });
+    REQUIRE(observer->removed_rows.empty());
+    observer->clear();
+
+    range_model->set_rows(2, { 15, 16 });
+
+    REQUIRE(observer->added_rows.size() == 1);
+    REQUIRE(observer->added_rows[0] == ModelObserver::Range { 2, 1 });
+    REQUIRE(observer->changed_ranges.size() == 1);
+    REQUIRE(observer->changed_ranges[0] == ModelObserver::Range { 1, 1 });
+    REQUIRE(observer->removed_rows.size() == 1);
+    REQUIRE(observer->removed_rows[0] == ModelObserver::Range { 4, 1 });
+    observer->clear();
+
+    REQUIRE(sorted_model->row_data(0) == 10);
+    REQUIRE(sorted_model->row_data(1) == 15);
+    REQUIRE(sorted_model->row_data(2) == 16);
+    REQUIRE(sorted_model->row_data(3) == 14);
+    REQUIRE(sorted_model->row_data(4) == 20);
+}
+
+SCENARIO("Batched model updates")
+{
+    auto model = std::make_shared<slint::VectorModel<int>>();
+    auto observer = std::make_shared<ModelObserver>();
+    model->attach_peer(observer);
+
+    {
+        auto guard = model->batch_update();
+        for (int i = 0; i < 10000; ++i) {
+            model->push_back(i);
+        }
+        model->set_row_data(5, 42);
+        REQUIRE(observer->added_rows.empty());
+    }
+    REQUIRE(model->row_count() == 10000);
+    REQUIRE(observer->added_rows == std::vector { ModelObserver::Range { 0, 10000 } });
+    REQUIRE(observer->changed_ranges.empty());
+    observer->clear();
+
+    model->begin_update();
+    model->begin_update();
+    for (int i = 0; i < 10; ++i) {
+        model->erase(3);
+    }
+    model->end_update();
+    REQUIRE(observer->removed_rows.empty());
+    model->set_row_data(1, 0);
+    model->set_row_data(2, 0);
+    model->set_row_data(0, 0);
+    model->end_update();
+    REQUIRE(observer->removed_rows == std::vector { ModelObserver::Range { 3, 10 } });
+    REQUIRE(observer->changed_ranges == std::vector { ModelObserver::Range { 0, 3 } });
+    REQUIRE(!observer->model_reset);
+    observer->clear();
+
+    {
+        auto guard = model->batch_update();
+        for (int i = 0; i < 1000; i += 2) {
+            model->set_row_data(i, 0);
+        }
+    }
+    REQUIRE(observer->changed_ranges.empty());
+    REQUIRE(observer->model_reset);
+    observer->clear();
+
+    // The added row moved before the views could read it
+    {
+        auto guard = model->batch_update();
+        model->insert(5, 1);
+        model->erase(0);
+    }
+    REQUIRE(observer->added_rows.empty());
+    REQUIRE(observer->model_reset);
+}
+
+SCENARIO("VectorModel bulk operations")
+{
+    auto model = std::make_shared<slint::VectorModel<int>>(std::vector<int> { 1, 2, 3 });
+    auto observer = std::make_shared<ModelObserver>();
+    model->attach_peer(observer);
+
+    std::vector<int> more { 4, 5, 6 };
+    model->append(more.begin(), more.end());
+    REQUIRE(observer->added_rows == std::vector { ModelObserver::Range { 3, 3 } });
+    model->insert(1, more.begin(), more.begin() + 2);
+    REQUIRE(observer->added_rows.back() == ModelObserver::Range { 1, 2 });
+    model->erase(0, 3);
+    REQUIRE(observer->removed_rows == std::vector { ModelObserver::Range { 0, 3 } });
+    REQUIRE(model->row_count() == 5);
+    REQUIRE(model->row_data(0) == 2);
+    REQUIRE(model->row_data(4) == 6);
+}
+
+SCENARIO("VectorModel set_vector")
+{
+    auto model = std::make_shared<slint::VectorModel<int>>(std::vector<int> { 1, 2, 3, 4, 5, 6 });
+    auto observer = std::make_shared<ModelObserver>();
+    model->attach_peer(observer);
+
+    model->set_vector({ 1, 2, 10, 4, 6, 7 });
+    REQUIRE(model->row_count() == 6);
+    for (int i = 0; i < 6; ++i) {
+        REQUIRE(model->row_data(i) == std::vector { 1, 2, 10, 4, 6, 7 }[i]);
+    }
+    REQUIRE(observer->removed_rows
+            == std::vector { ModelObserver::Range { 2, 1 }, ModelObserver::Range { 4, 1 } });
+    REQUIRE(observer->added_rows
+            == std::vector { ModelObserver::Range { 2, 1 }, ModelObserver::Range { 5, 1 } });
+    REQUIRE(observer->changed_rows.empty());
+    REQUIRE(!observer->model_reset);
+    observer->clear();
+
+    struct Row
+    {
+        int id;
+        int value;
+        bool operator==(const Row &) const = default;
+    };
+    auto rows = std::make_shared<slint::VectorModel<Row>>(
+            std::vector<Row> { { 1, 10 }, { 2, 20 }, { 3, 30 } });
+    rows->attach_peer(observer);
+    rows->set_vector({ { 1, 10 }, { 2, 21 }, { 3, 30 }, { 4, 40 } },
+                     [](const Row &row) { return row.id; });
+    REQUIRE(observer->changed_rows == std::vector { 1 });
+    REQUIRE(observer->added_rows == std::vector { ModelObserver::Range { 3, 1 } });
+    REQUIRE(observer->removed_rows.empty());
+    REQUIRE(rows->row_data(1)->value == 21);
+}
+
+/// A row that counts how often it is copied
+struct CountedRow
+{
+    int value;
+    static inline int copies = 0;
+
+    CountedRow(int v) : value(v) { }
+    CountedRow(const CountedRow &other) : value(other.value) { ++copies; }
+    CountedRow &operator=(const CountedRow &other)
+    {
+        value = other.value;
+        ++copies;
+        return *this;
+    }
+};
+
+SCENARIO("Adapters read the rows without copying them")
+{
+    std::vector<CountedRow> rows;
+    for (int i = 0; i < 100; ++i) {
+        rows.emplace_back(100 - i);
+    }
+    auto vec_model = std::make_shared<slint::VectorModel<CountedRow>>(std::move(rows));
+    CountedRow::copies = 0;
+
+    auto even_rows = std::make_shared<slint::FilterModel<CountedRow>>(
+            vec_model, [](const CountedRow &row) { return row.value % 2 == 0; });
+    auto sorted_rows = std::make_shared<slint::SortModel<CountedRow>>(
+            even_rows, [](const CountedRow &a, const CountedRow &b) { return a.value < b.value; });
+
+    REQUIRE(even_rows->row_count() == 50);
+    REQUIRE(sorted_rows->row_data_ptr(0)->value == 2);
+    REQUIRE(sorted_rows->visit_row_data(49, [](const CountedRow &row) { return row.value; })
+            == 100);
+    REQUIRE(CountedRow::copies == 0);
+
+    REQUIRE(sorted_rows->row_data(0)->value == 2);
+    REQUIRE(CountedRow::copies == 1);
+}
@@ -0,0 +1,125 @@
+// Copyright © SixtyFPS GmbH <info@slint-ui.com>
+// SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-Slint-commercial
+
+#define CATCH_CONFIG_MAIN
+#include "catch2/catch.hpp"
+
+#include <deque>
+#include <mutex>
+#include <slint.h>
+#include <slint_interpreter.h>
+#include <slint_platform.h>
+
+struct TestPlatform : slint::platform::Platform
+{
+    std::mutex mutex;
+    std::deque<slint::platform::Platform::Task> queue;
+    bool quit = false;
+    int window_count = 0;
+    std::shared_ptr<slint::platform::SoftwareWindow> window;
+
+    std::shared_ptr<slint::platform::SoftwareWindow> create_window_adapter() override
+    {
+        window_count++;
+        window = std::make_shared<slint::platform::SoftwareWindow>();
+        window->set_size(slint::PhysicalSize({ 40, 30 }));
+        return window;
+    }
+
+    void run_event_loop() override
+    {
+        for (;;) {
+            slint::platform::update_timers_and_animations();
+            std::optional<slint::platform::Platform::Task> task;
+            {
+                std::unique_lock lock(mutex);
+                if (quit) {
+                    quit = false;
+                    return;
+                }
+                if (!queue.empty()) {
+                    task.emplace(std::move(queue.front()));
+                    queue.pop_front();
+                }
+            }
+            if (task) {
+                std::move(*task).run();
+            }
+        }
+    }
+
+    void quit_event_loop() override
+    {
+        std::unique_lock lock(mutex);
+        quit = true;
+    }
+
+    void invoke_from_event_loop(slint::platform::Platform::Task task) override
+    {
+        std::unique_lock lock(mutex);
+        queue.push_back(std::move(task));
+    }
+};
+
+// The platform can only be set once per thread, so all the tests share it.
+static TestPlatform &test_platform()
+{
+    static TestPlatform *platform = [] {
+        auto platform = std::make_unique<TestPlatform>();
+        auto ptr = platform.get();
+        REQUIRE(slint::platform::Platform::set_platform(std::move(platform)));
+        return ptr;
+    }();
+    return *platform;
+}
+
+TEST_CASE("Render and dispatch events on a custom platform")
+{
+    using namespace slint::interpreter;
+    auto &platform = test_platform();
+    REQUIRE(!slint::platform::Platform::set_platform(std::make_unique<TestPlatform>()));
+
+    ComponentCompiler compiler;
+    auto comp_def = compiler.build_from_source(
+            "export Test := Window { background: #ff0000; property <int> clicks; "
+            "TouchArea { clicked => { clicks += 1; } } }",
+            "");
+    REQUIRE(comp_def.has_value());
+    auto instance = comp_def->create();
+    REQUIRE(platform.window_count == 1);
+    instance->show();
+
+    std::vector<slint::platform::Rgb565Pixel> buffer(40 * 30);
+    std::optional<slint::platform::RenderedRegion> region;
+    REQUIRE(platform.window->draw_if_needed(
+            [&](const auto &renderer) { region = renderer.render(buffer, 40); }));
+    REQUIRE(region.has_value());
+    REQUIRE(region->size.width == 40);
+    REQUIRE(region->size.height == 30);
+    REQUIRE(buffer[0].rgb == 0xf800);
+    REQUIRE(buffer[40 * 30 - 1].rgb == 0xf800);
+    REQUIRE(!platform.window->draw_if_needed([](const auto &) { }));
+
+    slint::LogicalPosition pos({ 10, 10 });
+    platform.window->dispatch_pointer_move_event(pos);
+    platform.window->dispatch_pointer_press_event(pos, slint::platform::PointerEventButton::Left);
+    platform.window->dispatch_pointer_release_event(pos,
+                                                    slint::platform::PointerEventButton::Left);
+    REQUIRE(*instance->get_property("clicks")->to_number() == 1);
+}
+
+TEST_CASE("Run the event loop of a custom platform")
+{
+    test_platform();
+    int called = 0;
+    slint::invoke_from_event_loop([&] {
+        called++;
+        slint::invoke_from_event_loop([&] {
+            called++;
+            slint::quit_event_loop();
+        });
+    });
+    REQUIRE(called == 0);
+    slint::run_event_loop();
+    REQUIRE(called == 2);
+}
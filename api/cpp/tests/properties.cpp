@@ -39,3 +39,108 @@ SCENARIO("Set after binding")
     prop.set(0);
     REQUIRE(prop.get() == 0);
 }
+
+namespace {
+struct CopyCounter
+{
+    int *copies;
+    explicit CopyCounter(int *copies) : copies(copies) { }
+    CopyCounter(const CopyCounter &other) : copies(other.copies) { ++*copies; }
+    CopyCounter &operator=(const CopyCounter &) = delete;
+};
+}
+
+SCENARIO("Callback arguments and handlers")
+{
+    using slint::private_api::Callback;
+
+    int copies = 0;
+    CopyCounter counter(&copies);
+
+    Callback<int(CopyCounter, int)> callback;
+    REQUIRE(callback.call(counter, 1) == 0);
+
+    int offset = 10;
+    auto *offset_ptr = &offset;
+    callback.set_handler(
+            [offset_ptr](const CopyCounter &, int value) { return value + *offset_ptr; });
+    REQUIRE(callback.call(counter, 5) == 15);
+    REQUIRE(copies == 0);
+
+    // A handler that is too large to be stored inline, and that mutates its state
+    auto calls = std::make_shared<int>(0);
+    callback.set_handler([calls, sum = 0](const CopyCounter &, int value) mutable {
+        ++*calls;
+        return sum += value;
+    });
+    REQUIRE(calls.use_count() == 2);
+    REQUIRE(callback.call(counter, 3) == 3);
+    REQUIRE(callback.call(counter, 4) == 7);
+    REQUIRE(*calls == 2);
+    REQUIRE(copies == 0);
+
+    // The native items call the handler from Rust with a tuple of values
+    std::tuple<CopyCounter, int> args { counter, 8 };
+    REQUIRE(copies == 1);
+    int result = 0;
+    slint::cbindgen_private::slint_callback_call(
+            reinterpret_cast<const slint::cbindgen_private::CallbackOpaque *>(&callback), &args,
+            &result);
+    REQUIRE(result == 15);
+
+    Callback<void(CopyCounter)> void_callback;
+    int void_calls = 0;
+    void_callback.set_handler([&void_calls](const CopyCounter &) { ++void_calls; });
+    void_callback.call(counter);
+    void_callback.call(counter);
+    REQUIRE(void_calls == 2);
+    REQUIRE(copies == 1);
+
+    callback.set_handler([](const CopyCounter &, int) { return 0; });
+    REQUIRE(calls.use_count() == 1);
+}
+
+SCENARIO("Binding closures")
+{
+    using slint::private_api::ClosureStorage;
+
+    Property<int> prop;
+    int base = 4;
+    auto *base_ptr = &base;
+    auto small_binding = [base_ptr] { return *base_ptr * 2; };
+    static_assert(ClosureStorage<decltype(small_binding)>::is_inline);
+    prop.set_binding(small_binding);
+    REQUIRE(prop.get() == 8);
+
+    auto evaluations = std::make_shared<int>(0);
+    auto large_binding = [evaluations, base_ptr] {
+        ++*evaluations;
+        return *base_ptr;
+    };
+    static_assert(!ClosureStorage<decltype(large_binding)>::is_inline);
+    prop.set_binding(std::move(large_binding));
+    REQUIRE(prop.get() == 4);
+    REQUIRE(*evaluations == 1);
+    REQUIRE(evaluations.use_count() == 2);
+    prop.set(1);
+    REQUIRE(evaluations.use_count() == 1);
+}
+
+SCENARIO("Binding updating the value in place")
+{
+    Property<slint::SharedVector<float>> cache;
+    float size = 10;
+    auto *size_ptr = &size;
+    cache.set_binding([size_ptr](slint::SharedVector<float> &value) {
+        value.clear();
+        value.push_back(0);
+        value.push_back(*size_ptr);
+    });
+    REQUIRE(cache.get() == slint::SharedVector<float> { 0, 10 });
+    auto *data = cache.get().begin();
+
+    size = 20;
+    cache.mark_dirty();
+    REQUIRE(cache.get() == slint::SharedVector<float> { 0, 20 });
+    REQUIRE(cache.get().begin() == data);
+}
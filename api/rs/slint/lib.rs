@@ -243,7 +243,8 @@ struct MyStruct {
 
 pub use i_slint_core::api::*;
 pub use i_slint_core::graphics::{
-    Brush, Color, Image, LoadImageError, Rgb8Pixel, Rgba8Pixel, RgbaColor, SharedPixelBuffer,
+    BorrowedOpenGLTextureOrigin, Brush, Color, Image, LoadImageError, Rgb8Pixel, Rgba8Pixel,
+    RgbaColor, SharedPixelBuffer,
 };
 pub use i_slint_core::model::{
     FilterModel, MapModel, Model, ModelExt, ModelNotify, ModelPeer, ModelRc, ModelTracker,
@@ -0,0 +1,317 @@
+// Copyright © SixtyFPS GmbH <info@slint-ui.com>
+// SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-Slint-commercial
+
+//! Headless benchmark of the frames of a component, split in phases
+
+use core::pin::Pin;
+use core::sync::atomic::{AtomicUsize, Ordering};
+use i_slint_core::api::PhysicalSize;
+use i_slint_core::graphics::Rgb8Pixel;
+use i_slint_core::item_rendering::ItemRenderer;
+use i_slint_core::item_tree::{ItemVisitorResult, TraversalOrder};
+use i_slint_core::items::{
+    BorderRectangle, BoxShadow, ClippedImage, ImageItem, ItemRc, Path, Rectangle, Text, TextInput,
+};
+use i_slint_core::lengths::{LogicalLength, LogicalRect, LogicalVector};
+use i_slint_core::software_renderer::SoftwareRenderer;
+use i_slint_core::window::{WindowAdapter, WindowInner};
+use std::alloc::{GlobalAlloc, Layout, System};
+use std::rc::Rc;
+use std::time::{Duration, Instant};
+
+static ALLOCATION_COUNT: AtomicUsize = AtomicUsize::new(0);
+
+/// A global allocator that counts the allocations, so that [`benchmark_frames`] can report
+/// them for each phase. Install it with `#[global_allocator]` in the final binary of a test,
+/// otherwise the allocation counts are zero.
+pub struct CountingAllocator;
+
+unsafe impl GlobalAlloc for CountingAllocator {
+    unsafe fn alloc(&self, layout: Layout) -> *mut u8 {
+        ALLOCATION_COUNT.fetch_add(1, Ordering::Relaxed);
+        System.alloc(layout)
+    }
+
+    unsafe fn alloc_zeroed(&self, layout: Layout) -> *mut u8 {
+        ALLOCATION_COUNT.fetch_add(1, Ordering::Relaxed);
+        System.alloc_zeroed(layout)
+    }
+
+    unsafe fn realloc(&self, ptr: *mut u8, layout: Layout, new_size: usize) -> *mut u8 {
+        ALLOCATION_COUNT.fetch_add(1, Ordering::Relaxed);
+        System.realloc(ptr, layout, new_size)
+    }
+
+    unsafe fn dealloc(&self, ptr: *mut u8, layout: Layout) {
+        System.dealloc(ptr, layout)
+    }
+}
+
+/// Returns the number of allocations made through the [`CountingAllocator`] so far
+pub fn allocation_count() -> usize {
+    ALLOCATION_COUNT.load(Ordering::Relaxed)
+}
+
+/// The parameters of [`benchmark_frames`]
+#[derive(Clone, Debug)]
+pub struct BenchmarkOptions {
+    /// The number of frames to render
+    pub frames: usize,
+    /// The time by which animations and timers are advanced before each frame
+    pub frame_interval: Duration,
+    /// The size of the window, in physical pixels
+    pub size: PhysicalSize,
+    /// Also render each frame with the software renderer into an offscreen buffer.
+    /// Text can only be rasterized if the glyphs were embedded when compiling the .slint file.
+    pub rasterize: bool,
+}
+
+impl Default for BenchmarkOptions {
+    fn default() -> Self {
+        Self {
+            frames: 100,
+            frame_interval: Duration::from_millis(16),
+            size: PhysicalSize::new(800, 600),
+            rasterize: false,
+        }
+    }
+}
+
+/// The time and the allocations spent in one phase, accumulated over all frames
+#[derive(Clone, Debug, Default)]
+pub struct PhaseStatistics {
+    /// The time spent in this phase over all frames
+    pub total_time: Duration,
+    /// The time of the slowest frame for this phase
+    pub max_time: Duration,
+    /// The number of allocations made in this phase over all frames
+    pub allocations: usize,
+}
+
+impl PhaseStatistics {
+    fn measure<R>(&mut self, phase: impl FnOnce() -> R) -> R {
+        let allocations = allocation_count();
+        let start = Instant::now();
+        let result = phase();
+        let elapsed = start.elapsed();
+        self.allocations += allocation_count() - allocations;
+        self.total_time += elapsed;
+        self.max_time = self.max_time.max(elapsed);
+        result
+    }
+}
+
+/// The result of [`benchmark_frames`]
+#[derive(Clone, Debug, Default)]
+pub struct BenchmarkResults {
+    /// The number of frames that were rendered
+    pub frames: usize,
+    /// Advancing animations and timers, including the callbacks of the timers
+    pub animations: PhaseStatistics,
+    /// Evaluating the geometry of every item, which runs the layouts
+    pub layout: PhaseStatistics,
+    /// Visiting the item tree and reading the properties needed to draw each item, which
+    /// evaluates their dirty bindings
+    pub bindings: PhaseStatistics,
+    /// Visiting the item tree again with all bindings up to date: the cost of the traversal alone
+    pub traversal: PhaseStatistics,
+    /// Rendering with the software renderer, if [`BenchmarkOptions::rasterize`] is set
+    pub rasterization: PhaseStatistics,
+    /// The number of items visited per frame, summed over all frames
+    pub items_visited: usize,
+    /// The number of items drawn per frame, summed over all frames
+    pub items_drawn: usize,
+}
+
+/// Renders `options.frames` frames of the component shown in `window_adapter`, without
+/// displaying them, and advances the mocked time between each frame.
+pub fn benchmark_frames(
+    window_adapter: &Rc<dyn WindowAdapter>,
+    options: &BenchmarkOptions,
+) -> BenchmarkResults {
+    let window = window_adapter.window();
+    let window_inner = WindowInner::from_pub(window);
+    window.set_size(options.size);
+
+    let software_renderer = SoftwareRenderer::<0>::new(Rc::downgrade(window_adapter));
+    let mut buffer = if options.rasterize {
+        vec![Rgb8Pixel::default(); (options.size.width * options.size.height) as usize]
+    } else {
+        Vec::new()
+    };
+
+    let mut results = BenchmarkResults::default();
+    for _ in 0..options.frames {
+        results.animations.measure(|| {
+            i_slint_core::tests::slint_mock_elapsed_time(options.frame_interval.as_millis() as _)
+        });
+
+        results.layout.measure(|| {
+            window_inner.update_window_properties();
+            i_slint_core::item_tree::visit_items(
+                &window_inner.component(),
+                TraversalOrder::BackToFront,
+                |_, item, _, _| {
+                    item.as_ref().geometry();
+                    ItemVisitorResult::Continue(())
+                },
+                (),
+            );
+        });
+
+        let mut renderer = TraversalRenderer::new(window, true);
+        results.bindings.measure(|| renderer.traverse(window_inner));
+
+        let mut renderer = TraversalRenderer::new(window, false);
+        results.traversal.measure(|| renderer.traverse(window_inner));
+        results.items_visited += renderer.items_visited;
+        results.items_drawn += renderer.items_drawn;
+
+        if options.rasterize {
+            results
+                .rasterization
+                .measure(|| software_renderer.render(&mut buffer, options.size.width as usize));
+        }
+        results.frames += 1;
+    }
+    results
+}
+
+/// An ItemRenderer that doesn't draw, and only reads the properties of each item when
+/// `read_properties` is set.
+struct TraversalRenderer<'a> {
+    window: &'a i_slint_core::api::Window,
+    read_properties: bool,
+    items_visited: usize,
+    items_drawn: usize,
+}
+
+impl<'a> TraversalRenderer<'a> {
+    fn new(window: &'a i_slint_core::api::Window, read_properties: bool) -> Self {
+        Self { window, read_properties, items_visited: 0, items_drawn: 0 }
+    }
+
+    fn traverse(&mut self, window_inner: &WindowInner) {
+        window_inner.draw_contents(|components| {
+            for (component, origin) in components {
+                i_slint_core::item_rendering::render_component_items(
+                    component, &mut *self, *origin,
+                );
+            }
+        });
+    }
+
+    fn draw(&mut self, read_properties: impl FnOnce()) {
+        self.items_drawn += 1;
+        if self.read_properties {
+            read_properties();
+        }
+    }
+}
+
+impl<'a> ItemRenderer for TraversalRenderer<'a> {
+    fn draw_rectangle(&mut self, rect: Pin<&Rectangle>, _: &ItemRc) {
+        self.draw(|| {
+            rect.background();
+        });
+    }
+
+    fn draw_border_rectangle(&mut self, rect: Pin<&BorderRectangle>, _: &ItemRc) {
+        self.draw(|| {
+            rect.background();
+            rect.border_width();
+            rect.border_radius();
+            rect.border_color();
+        });
+    }
+
+    fn draw_image(&mut self, image: Pin<&ImageItem>, _: &ItemRc) {
+        self.draw(|| {
+            image.source();
+            image.image_fit();
+        });
+    }
+
+    fn draw_clipped_image(&mut self, image: Pin<&ClippedImage>, _: &ItemRc) {
+        self.draw(|| {
+            image.source();
+            image.image_fit();
+            image.colorize();
+            image.source_clip_x();
+            image.source_clip_y();
+            image.source_clip_width();
+            image.source_clip_height();
+        });
+    }
+
+    fn draw_text(&mut self, text: Pin<&Text>, _: &ItemRc) {
+        self.draw(|| {
+            text.text();
+            text.font_family();
+            text.font_size();
+            text.color();
+        });
+    }
+
+    fn draw_text_input(&mut self, text_input: Pin<&TextInput>, _: &ItemRc) {
+        self.draw(|| {
+            text_input.text();
+            text_input.font_family();
+            text_input.font_size();
+            text_input.color();
+        });
+    }
+
+    fn draw_path(&mut self, path: Pin<&Path>, _: &ItemRc) {
+        self.draw(|| {
+            path.elements();
+            path.fill();
+            path.stroke();
+            path.stroke_width();
+        });
+    }
+
+    fn draw_box_shadow(&mut self, box_shadow: Pin<&BoxShadow>, _: &ItemRc) {
+        self.draw(|| {
+            box_shadow.color();
+            box_shadow.blur();
+            box_shadow.offset_x();
+            box_shadow.offset_y();
+        });
+    }
+
+    fn combine_clip(&mut self, _: LogicalRect, _: LogicalLength, _: LogicalLength) -> bool {
+        true
+    }
+
+    fn get_current_clip(&self) -> LogicalRect {
+        Default::default()
+    }
+
+    fn filter_item(&mut self, item: Pin<i_slint_core::items::ItemRef>) -> (bool, LogicalRect) {
+        self.items_visited += 1;
+        (true, item.as_ref().geometry())
+    }
+
+    fn translate(&mut self, _: LogicalVector) {}
+    fn rotate(&mut self, _: f32) {}
+    fn apply_opacity(&mut self, _: f32) {}
+    fn save_state(&mut self) {}
+    fn restore_state(&mut self) {}
+
+    fn scale_factor(&self) -> f32 {
+        self.window.scale_factor()
+    }
+
+    fn draw_cached_pixmap(&mut self, _: &ItemRc, _: &dyn Fn(&mut dyn FnMut(u32, u32, &[u8]))) {}
+
+    fn draw_string(&mut self, _: &str, _: i_slint_core::Color) {}
+
+    fn window(&self) -> &i_slint_core::api::Window {
+        self.window
+    }
+
+    fn as_any(&mut self) -> Option<&mut dyn core::any::Any> {
+        None
+    }
+}
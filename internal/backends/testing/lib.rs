@@ -120,6 +120,9 @@ pub fn init() {
         .expect("platform already initialized");
 }
 
+mod benchmark;
+pub use benchmark::*;
+
 /// This module contains functions useful for unit tests
 mod for_unit_test {
     use core::cell::Cell;
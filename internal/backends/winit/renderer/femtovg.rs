@@ -14,7 +14,7 @@
     LogicalLength, LogicalPoint, LogicalRect, LogicalSize, PhysicalPx, ScaleFactor,
 };
 use i_slint_core::renderer::Renderer;
-use i_slint_core::window::{WindowAdapter, WindowInner};
+use i_slint_core::window::{WindowAdapter, WindowAdapterSealed, WindowInner};
 use i_slint_core::Brush;
 
 use crate::WindowSystemName;
@@ -37,6 +37,9 @@ pub struct FemtoVGRenderer {
     #[cfg(target_arch = "wasm32")]
     canvas_id: String,
     rendering_notifier: RefCell<Option<Box<dyn RenderingNotifier>>>,
+    /// The text which glyphs are rasterized into the glyph atlas on the next frame, by
+    /// prewarm_glyph_cache()
+    pending_glyph_prewarm: RefCell<Vec<(fonts::Font, String)>>,
 }
 
 impl super::WinitCompatibleRenderer for FemtoVGRenderer {
@@ -52,6 +55,7 @@ fn new(
             #[cfg(target_arch = "wasm32")]
             canvas_id,
             rendering_notifier: Default::default(),
+            pending_glyph_prewarm: Default::default(),
         }
     }
 
@@ -110,8 +114,16 @@ fn create_canvas(&self, window_builder: winit::window::WindowBuilder) -> FemtoVG
         )
         .unwrap();
         let canvas = Rc::new(RefCell::new(canvas));
+
+        #[cfg(not(target_arch = "wasm32"))]
+        let gl = unsafe {
+            glow::Context::from_loader_function(|s| opengl_context.get_proc_address(s) as *const _)
+        };
+
         let result = FemtoVGCanvas {
             canvas,
+            #[cfg(not(target_arch = "wasm32"))]
+            gl,
             graphics_cache: Default::default(),
             texture_cache: Default::default(),
             rendering_metrics_collector,
@@ -210,6 +222,15 @@ fn render(&self, canvas: &FemtoVGCanvas, window_adapter: &dyn WindowAdapter) {
                 collector.measure_frame_rendered(&mut item_renderer);
             }
 
+            // Drawing the text with a transparent paint rasterizes its glyphs into the atlas
+            for (font, text) in self.pending_glyph_prewarm.take() {
+                let paint = font.init_paint(
+                    PhysicalLength::default(),
+                    femtovg::Paint::color(femtovg::Color::rgba(0, 0, 0, 0)),
+                );
+                canvas.canvas.borrow_mut().fill_text(0., 0., text, paint).ok();
+            }
+
             canvas.canvas.borrow_mut().flush();
 
             // Delete any images and layer images (and their FBOs) before making the context not current anymore, to
@@ -400,6 +421,23 @@ fn register_font_from_path(
         fonts::register_font_from_path(path)
     }
 
+    fn prewarm_glyph_cache(
+        &self,
+        font_request: i_slint_core::graphics::FontRequest,
+        pixel_sizes: &[LogicalLength],
+        characters: &str,
+        scale_factor: ScaleFactor,
+    ) {
+        let fonts =
+            fonts::prewarm_glyph_cache(&font_request, pixel_sizes, characters, scale_factor);
+        self.pending_glyph_prewarm
+            .borrow_mut()
+            .extend(fonts.into_iter().map(|font| (font, characters.to_string())));
+        if let Some(window_adapter) = self.window_adapter_weak.upgrade() {
+            window_adapter.request_redraw();
+        }
+    }
+
     fn set_rendering_notifier(
         &self,
         callback: Box<dyn RenderingNotifier>,
@@ -415,6 +453,9 @@ fn set_rendering_notifier(
 
 pub struct FemtoVGCanvas {
     canvas: CanvasRc,
+    /// Used to draw the images of borrowed OpenGL textures, which femtovg can't import
+    #[cfg(not(target_arch = "wasm32"))]
+    gl: glow::Context,
     graphics_cache: itemrenderer::ItemGraphicsCache,
     texture_cache: RefCell<images::TextureCache>,
     rendering_metrics_collector: Option<Rc<RenderingMetricsCollector>>,
@@ -141,6 +141,28 @@ pub(crate) fn text_size(
         / scale_factor
 }
 
+/// Loads the fonts, including the fallback fonts, that the `characters` need at each of the
+/// `pixel_sizes` and shapes them, so that the text context caches them. Returns the font of each
+/// size, to rasterize the glyphs into the glyph atlas of a canvas.
+pub(crate) fn prewarm_glyph_cache(
+    font_request: &FontRequest,
+    pixel_sizes: &[LogicalLength],
+    characters: &str,
+    scale_factor: ScaleFactor,
+) -> Vec<Font> {
+    pixel_sizes
+        .iter()
+        .map(|pixel_size| {
+            let request = FontRequest { pixel_size: Some(*pixel_size), ..font_request.clone() };
+            let font =
+                FONT_CACHE.with(|cache| cache.borrow_mut().font(request, scale_factor, characters));
+            let paint = font.init_paint(PhysicalLength::default(), femtovg::Paint::default());
+            font.text_context.measure_text(0., 0., characters, paint).ok();
+            font
+        })
+        .collect()
+}
+
 #[derive(Copy, Clone)]
 struct LoadedFont {
     femtovg_font_id: femtovg::FontId,
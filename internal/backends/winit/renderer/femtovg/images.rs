@@ -122,8 +122,34 @@ pub fn new_from_image(
             }
         };
 
+        i_slint_core::graphics::frame_statistics::record_texture_upload();
         return Some(Self::adopt(canvas, image_id));
     }
+
+    // Upload the pixels of the image into this texture if it has the same size, format and
+    // flags, instead of allocating a new texture. Returns false if the image doesn't match.
+    pub fn update_from_image(&self, image: &ImageInner, scaling: ImageRendering) -> bool {
+        let buffer = match image {
+            ImageInner::EmbeddedImage { buffer, .. } => buffer,
+            _ => return false,
+        };
+        let image_flags = match scaling {
+            ImageRendering::Smooth => femtovg::ImageFlags::empty(),
+            ImageRendering::Pixelated => femtovg::ImageFlags::NEAREST,
+        };
+        let (image_source, flags) = image_buffer_to_image_source(buffer);
+        let mut canvas = self.canvas.borrow_mut();
+        let matches = canvas.image_info(self.id).map_or(false, |info| {
+            info.format() == image_source.format()
+                && (info.width(), info.height()) == image_source.dimensions()
+                && info.flags() == image_flags | flags
+        });
+        if !matches || canvas.update_image(self.id, image_source, 0, 0).is_err() {
+            return false;
+        }
+        i_slint_core::graphics::frame_statistics::record_texture_upload();
+        true
+    }
 }
 
 impl Drop for Texture {
@@ -72,6 +72,11 @@ pub struct GLItemRenderer<'a> {
     texture_cache: &'a RefCell<super::images::TextureCache>,
     box_shadow_cache: FemtovgBoxShadowCache,
     canvas: CanvasRc,
+    #[cfg(not(target_arch = "wasm32"))]
+    gl: &'a glow::Context,
+    /// The height of the window in physical pixels, to convert to the OpenGL window coordinates
+    #[cfg(not(target_arch = "wasm32"))]
+    height: u32,
     // Layers that were scheduled for rendering where we can't delete the femtovg::ImageId yet
     // because that can only happen after calling `flush`. Otherwise femtovg ends up processing
     // `set_render_target` commands with image ids that have been deleted.
@@ -948,6 +953,10 @@ pub fn new(
             texture_cache: &canvas.texture_cache,
             box_shadow_cache: Default::default(),
             canvas: canvas.canvas.clone(),
+            #[cfg(not(target_arch = "wasm32"))]
+            gl: &canvas.gl,
+            #[cfg(not(target_arch = "wasm32"))]
+            height,
             layer_images_to_delete_after_flush: Default::default(),
             window,
             scale_factor,
@@ -1170,7 +1179,32 @@ fn draw_image_impl(
             return;
         }
 
+        let image = source_property.get();
+        if let ImageInner::BorrowedOpenGLTexture(texture) = <&ImageInner>::from(&image) {
+            self.graphics_cache.release(item_rc);
+            #[cfg(not(target_arch = "wasm32"))]
+            self.draw_borrowed_texture(
+                texture,
+                source_clip_rect,
+                PhysicalSize::from_lengths(target_w, target_h),
+                image_fit,
+                image_rendering,
+            );
+            #[cfg(target_arch = "wasm32")]
+            let _ = texture;
+            return;
+        }
+
         let cached_image = loop {
+            // The texture of the previous image, if it is only used by this item. A new image with
+            // the same size and format, like the next frame of a video, is uploaded into it.
+            let previous_texture = self
+                .graphics_cache
+                .with_entry(item_rc, |entry| match entry {
+                    Some(ItemGraphicsCacheEntry::Texture(texture)) => Some(texture.clone()),
+                    _ => None,
+                })
+                .filter(|texture| Rc::strong_count(texture) == 2);
             let image_cache_entry = self.graphics_cache.get_or_update_cache_entry(item_rc, || {
                 let image = source_property.get();
                 let image_inner: &ImageInner = (&image).into();
@@ -1204,12 +1238,19 @@ fn draw_image_impl(
                         )
                     })
                     .or_else(|| {
-                        Texture::new_from_image(
-                            image_inner,
-                            &self.canvas,
-                            target_size_for_scalable_source,
-                            image_rendering,
-                        )
+                        previous_texture
+                            .filter(|texture| {
+                                target_size_for_scalable_source.is_none()
+                                    && texture.update_from_image(image_inner, image_rendering)
+                            })
+                            .or_else(|| {
+                                Texture::new_from_image(
+                                    image_inner,
+                                    &self.canvas,
+                                    target_size_for_scalable_source,
+                                    image_rendering,
+                                )
+                            })
                     })
                     .map(ItemGraphicsCacheEntry::Texture)
                     .map(|cache_entry| {
@@ -1308,6 +1349,132 @@ fn draw_image_impl(
         })
     }
 
+    /// Copies the texture to the window with a framebuffer blit, since femtovg can't import
+    /// textures. A blit replaces the pixels of the target rectangle: the image is not drawn if it
+    /// must be blended or drawn in a layer, and its bounding box is filled if it's rotated.
+    #[cfg(not(target_arch = "wasm32"))]
+    fn draw_borrowed_texture(
+        &mut self,
+        texture: &i_slint_core::graphics::BorrowedOpenGLTexture,
+        source_clip_rect: IntRect,
+        target_size: PhysicalSize,
+        image_fit: ImageFit,
+        image_rendering: ImageRendering,
+    ) {
+        use glow::HasContext;
+        use i_slint_core::graphics::BorrowedOpenGLTextureOrigin;
+
+        let state = self.state.last().unwrap();
+        if state.global_alpha < 1.
+            || !matches!(state.current_render_target, femtovg::RenderTarget::Screen)
+        {
+            return;
+        }
+
+        let mut source = if source_clip_rect.is_empty() {
+            PhysicalRect::from_size(PhysicalSize::from_untyped(texture.size.cast()))
+        } else {
+            PhysicalRect::from_untyped(&source_clip_rect.cast())
+        };
+        if source.is_empty() {
+            return;
+        }
+        let mut target = PhysicalRect::from_size(target_size);
+        match image_fit {
+            ImageFit::Fill => {}
+            ImageFit::Cover => {
+                let ratio = f32::max(
+                    target_size.width / source.width(),
+                    target_size.height / source.height(),
+                );
+                let visible_size = target_size / ratio;
+                source.origin += ((source.size - visible_size) / 2.).to_vector();
+                source.size = visible_size;
+            }
+            ImageFit::Contain => {
+                let ratio = f32::min(
+                    target_size.width / source.width(),
+                    target_size.height / source.height(),
+                );
+                target.size = source.size * ratio;
+                target.origin += ((target_size - target.size) / 2.).to_vector();
+            }
+        }
+
+        // Transform the target and the clip to the window, whose y axis points up in OpenGL
+        let to_window = |rect: PhysicalRect| {
+            let mut path = rect_to_path(rect);
+            let bounds = self.canvas.borrow_mut().path_bbox(&mut path);
+            let height = self.height as f32;
+            [bounds.minx, height - bounds.maxy, bounds.maxx, height - bounds.miny]
+                .map(|coord| coord.round() as i32)
+        };
+        let target = to_window(target);
+        let clip = to_window(self.get_current_clip() * self.scale_factor);
+        if clip[0] >= clip[2] || clip[1] >= clip[3] {
+            return;
+        }
+
+        let height = texture.size.height as f32;
+        let (source_top, source_bottom) = match texture.origin {
+            BorrowedOpenGLTextureOrigin::TopLeft => (source.min_y(), source.max_y()),
+            BorrowedOpenGLTextureOrigin::BottomLeft => {
+                (height - source.min_y(), height - source.max_y())
+            }
+        };
+        let filter = match image_rendering {
+            ImageRendering::Smooth => glow::LINEAR,
+            ImageRendering::Pixelated => glow::NEAREST,
+        };
+
+        // Draw what femtovg rendered so far below the image
+        self.canvas.borrow_mut().flush();
+
+        let gl = self.gl;
+        unsafe {
+            let framebuffer = match gl.create_framebuffer() {
+                Ok(framebuffer) => framebuffer,
+                Err(_) => return,
+            };
+            let previous_read_framebuffer = gl.get_parameter_i32(glow::READ_FRAMEBUFFER_BINDING);
+            let scissor_test_enabled = gl.is_enabled(glow::SCISSOR_TEST);
+
+            gl.bind_framebuffer(glow::READ_FRAMEBUFFER, Some(framebuffer));
+            gl.framebuffer_texture_2d(
+                glow::READ_FRAMEBUFFER,
+                glow::COLOR_ATTACHMENT0,
+                glow::TEXTURE_2D,
+                Some(glow::NativeTexture(texture.texture_id)),
+                0,
+            );
+            gl.enable(glow::SCISSOR_TEST);
+            gl.scissor(clip[0], clip[1], clip[2] - clip[0], clip[3] - clip[1]);
+            // The bottom of the target is its first row in the window coordinates
+            gl.blit_framebuffer(
+                source.min_x().round() as i32,
+                source_bottom.round() as i32,
+                source.max_x().round() as i32,
+                source_top.round() as i32,
+                target[0],
+                target[1],
+                target[2],
+                target[3],
+                glow::COLOR_BUFFER_BIT,
+                filter,
+            );
+
+            if !scissor_test_enabled {
+                gl.disable(glow::SCISSOR_TEST);
+            }
+            gl.bind_framebuffer(
+                glow::READ_FRAMEBUFFER,
+                core::num::NonZeroU32::new(previous_read_framebuffer as u32)
+                    .map(glow::NativeFramebuffer),
+            );
+            gl.delete_framebuffer(framebuffer);
+        }
+    }
+
     fn brush_to_paint(&self, brush: Brush, path: &mut femtovg::Path) -> Option<femtovg::Paint> {
         if brush.is_transparent() {
             return None;
@@ -301,6 +301,16 @@ fn register_font_from_path(
         textlayout::register_font_from_path(path)
     }
 
+    fn prewarm_glyph_cache(
+        &self,
+        font_request: i_slint_core::graphics::FontRequest,
+        pixel_sizes: &[LogicalLength],
+        characters: &str,
+        scale_factor: ScaleFactor,
+    ) {
+        textlayout::prewarm_glyph_cache(font_request, pixel_sizes, characters, scale_factor)
+    }
+
     fn set_rendering_notifier(
         &self,
         callback: Box<dyn RenderingNotifier>,
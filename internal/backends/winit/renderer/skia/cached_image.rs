@@ -60,6 +60,7 @@ pub(crate) fn as_skia_image(
                 SharedImageBuffer::RGBA8Premultiplied(pixels) => pixels,
             };
 
+            i_slint_core::graphics::frame_statistics::record_texture_upload();
             let image_info = skia_safe::ImageInfo::new(
                 skia_safe::ISize::new(pixels.width() as i32, pixels.height() as i32),
                 skia_safe::ColorType::RGBA8888,
@@ -74,6 +75,8 @@ pub(crate) fn as_skia_image(
             )
         }
         ImageInner::StaticTextures(_) => todo!(),
+        // Not supported, see Image::from_borrowed_gl_2d_rgba_texture()
+        ImageInner::BorrowedOpenGLTexture(..) => None,
         ImageInner::BackendStorage(x) => {
             vtable::VRc::borrow(x).downcast::<SkiaCachedImage>().map(|x| x.image.clone())
         }
@@ -81,6 +84,7 @@ pub(crate) fn as_skia_image(
 }
 
 fn image_buffer_to_skia_image(buffer: &SharedImageBuffer) -> Option<skia_safe::Image> {
+    i_slint_core::graphics::frame_statistics::record_texture_upload();
     let (data, bpl, size, color_type, alpha_type) = match buffer {
         SharedImageBuffer::RGB8(pixels) => {
             // RGB888 with one byte per component is not supported by Skia right now. Convert once to RGBA8 :-(
@@ -186,6 +186,42 @@ pub fn register_font_from_memory(data: &'static [u8]) -> Result<(), Box<dyn std:
     register_font(CustomFontSource::ByData(data))
 }
 
+/// Lays out the `characters` at each of the `pixel_sizes`, which resolves their fallback fonts, and
+/// draws them into a raster surface, which puts their glyphs into Skia's glyph cache.
+pub fn prewarm_glyph_cache(
+    font_request: FontRequest,
+    pixel_sizes: &[LogicalLength],
+    characters: &str,
+    scale_factor: ScaleFactor,
+) {
+    const SURFACE_SIZE: i32 = 512;
+    let mut surface = match skia_safe::Surface::new_raster_n32_premul((SURFACE_SIZE, SURFACE_SIZE))
+    {
+        Some(surface) => surface,
+        None => return,
+    };
+    for pixel_size in pixel_sizes {
+        let (layout, _) = create_layout(
+            FontRequest { pixel_size: Some(*pixel_size), ..font_request.clone() },
+            scale_factor,
+            characters,
+            None,
+            Some(PhysicalLength::new(SURFACE_SIZE as f32)),
+            Default::default(),
+            Default::default(),
+            Default::default(),
+            Default::default(),
+            None,
+        );
+        // The glyphs outside of the surface are not drawn, so draw the lines one surface at a time
+        let mut y = 0.;
+        while y < layout.height() {
+            layout.paint(surface.canvas(), (0., -y));
+            y += SURFACE_SIZE as f32;
+        }
+    }
+}
+
 pub fn register_font_from_path(path: &std::path::Path) -> Result<(), Box<dyn std::error::Error>> {
     register_font(CustomFontSource::ByPath(path.into()))
 }
@@ -16,15 +16,15 @@
 use crate::object_tree::{Component, Document, ElementRc};
 
 #[cfg(feature = "cpp")]
-mod cpp;
+pub mod cpp;
 
 #[cfg(feature = "rust")]
 pub mod rust;
 
-#[derive(Copy, Clone, Debug, PartialEq)]
+#[derive(Clone, Debug, PartialEq)]
 pub enum OutputFormat {
     #[cfg(feature = "cpp")]
-    Cpp,
+    Cpp(cpp::Config),
     #[cfg(feature = "rust")]
     Rust,
     Interpreter,
@@ -35,7 +35,9 @@ impl OutputFormat {
     pub fn guess_from_extension(path: &std::path::Path) -> Option<Self> {
         match path.extension().and_then(|ext| ext.to_str()) {
             #[cfg(feature = "cpp")]
-            Some("cpp") | Some("cxx") | Some("h") | Some("hpp") => Some(Self::Cpp),
+            Some("cpp") | Some("cxx") | Some("h") | Some("hpp") => {
+                Some(Self::Cpp(cpp::Config::default()))
+            }
             #[cfg(feature = "rust")]
             Some("rs") => Some(Self::Rust),
             _ => None,
@@ -48,7 +50,7 @@ impl std::str::FromStr for OutputFormat {
     fn from_str(s: &str) -> Result<Self, Self::Err> {
         match s {
             #[cfg(feature = "cpp")]
-            "cpp" => Ok(Self::Cpp),
+            "cpp" => Ok(Self::Cpp(cpp::Config::default())),
             #[cfg(feature = "rust")]
             "rust" => Ok(Self::Rust),
             "llr" => Ok(Self::Llr),
@@ -57,24 +59,28 @@ fn from_str(s: &str) -> Result<Self, Self::Err> {
     }
 }
 
+/// Writes the code generated for `doc` to `destination`. Returns the text of the other files
+/// generated by the formats that produce more than one, which are the .cpp files of
+/// [`cpp::Config::cpp_file_count`] for C++. The caller is responsible for writing them.
 pub fn generate(
     format: OutputFormat,
     destination: &mut impl std::io::Write,
     doc: &Document,
-) -> std::io::Result<()> {
+) -> std::io::Result<Vec<String>> {
     #![allow(unused_variables)]
     #![allow(unreachable_code)]
 
     if matches!(doc.root_component.root_element.borrow().base_type, ElementType::Error) {
         // empty document, nothing to generate
-        return Ok(());
+        return Ok(Vec::new());
     }
 
     match format {
         #[cfg(feature = "cpp")]
-        OutputFormat::Cpp => {
-            let output = cpp::generate(doc);
-            write!(destination, "{}", output)?;
+        OutputFormat::Cpp(config) => {
+            let (header, cpp_files) = cpp::generate(doc, config);
+            write!(destination, "{}", header)?;
+            return Ok(cpp_files.iter().map(ToString::to_string).collect());
         }
         #[cfg(feature = "rust")]
         OutputFormat::Rust => {
@@ -95,7 +101,7 @@ pub fn generate(
             )?;
         }
     }
-    Ok(())
+    Ok(Vec::new())
 }
 
 /// A reference to this trait is passed to the [`build_item_tree`] function.
@@ -8,6 +8,16 @@
 
 use std::fmt::Write;
 
+/// The configuration of the C++ code generator
+#[derive(Clone, Debug, Default, PartialEq)]
+pub struct Config {
+    /// When not 0, the definitions of the functions are moved out of the header into this
+    /// number of .cpp files, so that they can be compiled in parallel.
+    pub cpp_file_count: usize,
+    /// How the .cpp files include the generated header
+    pub header_include: String,
+}
+
 fn ident(ident: &str) -> String {
     if ident.contains('-') {
         ident.replace('-', "_")
@@ -65,6 +75,8 @@ mod cpp_ast {
     use std::cell::Cell;
     use std::fmt::{Display, Error, Formatter};
     thread_local!(static INDENTATION : Cell<u32> = Cell::new(0));
+    /// Set while a .cpp file is rendered, whose definitions must not be `inline`
+    thread_local!(static IN_CPP_FILE : Cell<bool> = Cell::new(false));
     fn indent(f: &mut Formatter<'_>) -> Result<(), Error> {
         INDENTATION.with(|i| {
             for _ in 0..(i.get()) {
@@ -77,22 +89,76 @@ fn indent(f: &mut Formatter<'_>) -> Result<(), Error> {
     ///A full C++ file
     #[derive(Default, Debug)]
     pub struct File {
+        /// A .cpp file rather than a header
+        pub is_cpp_file: bool,
         pub includes: Vec<String>,
+        /// The embedded resources
+        pub resources: Vec<Declaration>,
         pub declarations: Vec<Declaration>,
         pub definitions: Vec<Declaration>,
     }
 
+    impl File {
+        /// Moves the definitions that don't need to be in the header, and the data of the
+        /// embedded resources, to `count` .cpp files that include the header with `header_include`.
+        /// The .cpp files can then be compiled in parallel.
+        pub fn split_off_cpp_files(&mut self, header_include: &str, count: usize) -> Vec<File> {
+            if count == 0 {
+                return Vec::new();
+            }
+            let (mut definitions, header_definitions) =
+                std::mem::take(&mut self.definitions).into_iter().partition::<Vec<_>, _>(|d| {
+                    match d {
+                        // templates must be visible where they are instantiated
+                        Declaration::Function(f) => f.template_parameters.is_none(),
+                        // the definition of static members
+                        Declaration::Var(v) => v.name.contains("::"),
+                        Declaration::Struct(_) | Declaration::TypeAlias(_) => false,
+                    }
+                });
+            self.definitions = header_definitions;
+
+            let mut cpp_resources = Vec::with_capacity(self.resources.len());
+            for resource in &mut self.resources {
+                if let Declaration::Var(var) = resource {
+                    let ty = var.ty.trim_start_matches("inline ").to_owned();
+                    cpp_resources.push(Declaration::Var(Var {
+                        ty: ty.clone(),
+                        name: var.name.clone(),
+                        array_size: var.array_size,
+                        init: var.init.take(),
+                    }));
+                    var.ty = format!("extern {}", ty);
+                }
+            }
+
+            let chunk_size = (definitions.len() + count - 1) / count;
+            let mut cpp_files = (0..count)
+                .map(|_| File {
+                    is_cpp_file: true,
+                    includes: vec![format!("\"{}\"", header_include)],
+                    definitions: definitions.drain(..chunk_size.min(definitions.len())).collect(),
+                    ..Default::default()
+                })
+                .collect::<Vec<_>>();
+            cpp_files[0].resources = cpp_resources;
+            cpp_files
+        }
+    }
+
     impl Display for File {
         fn fmt(&self, f: &mut Formatter<'_>) -> Result<(), Error> {
+            if !self.is_cpp_file {
+                writeln!(f, "#pragma once")?;
+            }
             for i in &self.includes {
                 writeln!(f, "#include {}", i)?;
             }
-            for d in &self.declarations {
-                write!(f, "\n{}", d)?;
-            }
-            for d in &self.definitions {
+            IN_CPP_FILE.with(|x| x.set(self.is_cpp_file));
+            for d in self.resources.iter().chain(&self.declarations).chain(&self.definitions) {
                 write!(f, "\n{}", d)?;
             }
+            IN_CPP_FILE.with(|x| x.set(false));
             Ok(())
         }
     }
@@ -203,8 +269,11 @@ fn fmt(&self, f: &mut Formatter<'_>) -> Result<(), Error> {
             if self.is_friend {
                 write!(f, "friend ")?;
             }
-            // all functions are `inline` because we are in a header
-            write!(f, "inline ")?;
+            // all the definitions are `inline` because we are in a header, unless the
+            // definitions were moved to a .cpp file
+            if self.statements.is_some() && !IN_CPP_FILE.with(Cell::get) {
+                write!(f, "inline ")?;
+            }
             if !self.is_constructor_or_destructor {
                 write!(f, "auto ")?;
             }
@@ -395,6 +464,30 @@ fn property_set_value_code(
     format!("{}.set({})", prop, value_expr)
 }
 
+/// Rewrites the call that solves the layout in the binding of a layout cache, so that it writes
+/// into the previous value of the cache, called `layout_cache`, and reuses its memory.
+/// Returns false if the binding doesn't solve a layout.
+fn solve_layout_in_place(expression: &mut llr::Expression) -> bool {
+    fn rewrite(expression: &mut llr::Expression) -> usize {
+        if let llr::Expression::ExtraBuiltinFunctionCall { function, arguments, return_ty } =
+            expression
+        {
+            if *return_ty == Type::LayoutCache && function.starts_with("solve_") {
+                arguments.push(llr::Expression::ReadLocalVariable {
+                    name: "layout_cache".into(),
+                    ty: Type::LayoutCache,
+                });
+                *return_ty = Type::Void;
+                return 1;
+            }
+        }
+        let mut solved = 0;
+        expression.visit_mut(|e| solved += rewrite(e));
+        solved
+    }
+    rewrite(expression) == 1
+}
+
 fn handle_property_init(
     prop: &llr::PropertyReference,
     binding_expression: &llr::BindingExpression,
@@ -422,6 +515,22 @@ fn handle_property_init(
             code = compile_expression_wrap_return(&binding_expression.expression.borrow(), &ctx2)
         ));
     } else {
+        if *prop_type == Type::LayoutCache && !binding_expression.is_constant {
+            let mut expression = binding_expression.expression.borrow().clone();
+            if solve_layout_in_place(&mut expression) {
+                init.push(format!(
+                    "{prop_access}.set_binding(
+                        [this](slint::SharedVector<float> &layout_cache) {{
+                            [[maybe_unused]] auto self = this;
+                            {code};
+                        }});",
+                    prop_access = prop_access,
+                    code = compile_expression(&expression, ctx)
+                ));
+                return;
+            }
+        }
+
         let init_expr =
             compile_expression_wrap_return(&binding_expression.expression.borrow(), ctx);
 
@@ -468,8 +577,12 @@ fn handle_property_init(
     }
 }
 
-/// Returns the text of the C++ code produced by the given root component
-pub fn generate(doc: &Document) -> impl std::fmt::Display {
+/// Returns the text of the C++ header produced by the given root component, and of the
+/// `config.cpp_file_count` .cpp files the definitions were moved to
+pub fn generate(
+    doc: &Document,
+    config: Config,
+) -> (impl std::fmt::Display, Vec<impl std::fmt::Display>) {
     let mut file = File::default();
 
     file.includes.push("<array>".into());
@@ -478,7 +591,7 @@ pub fn generate(doc: &Document) -> impl std::fmt::Display {
     file.includes.push("<cmath>".into()); // TODO: ideally only include this if needed (by floor/ceil/round)
     file.includes.push("<slint.h>".into());
 
-    file.declarations.extend(doc.root_component.embedded_file_resources.borrow().iter().map(
+    file.resources.extend(doc.root_component.embedded_file_resources.borrow().iter().map(
         |(path, er)| {
             match &er.kind {
                 crate::embedded_resources::EmbeddedResourcesKind::RawData => {
@@ -561,7 +674,8 @@ pub fn generate(doc: &Document) -> impl std::fmt::Display {
         ..Default::default()
     }));
 
-    file
+    let cpp_files = file.split_off_cpp_files(&config.header_include, config.cpp_file_count);
+    (file, cpp_files)
 }
 
 fn generate_struct(file: &mut File, name: &str, fields: &BTreeMap<String, Type>) {
@@ -656,7 +770,7 @@ fn generate_public_component(file: &mut File, component: &llr::PublicComponent)
         Access::Public,
         Declaration::Function(Function {
             name: "show".into(),
-            signature: "()".into(),
+            signature: "() -> void".into(),
             statements: Some(vec!["m_window.show();".into()]),
             ..Default::default()
         }),
@@ -666,7 +780,7 @@ fn generate_public_component(file: &mut File, component: &llr::PublicComponent)
         Access::Public,
         Declaration::Function(Function {
             name: "hide".into(),
-            signature: "()".into(),
+            signature: "() -> void".into(),
             statements: Some(vec!["m_window.hide();".into()]),
             ..Default::default()
         }),
@@ -689,7 +803,7 @@ fn generate_public_component(file: &mut File, component: &llr::PublicComponent)
         Access::Public,
         Declaration::Function(Function {
             name: "run".into(),
-            signature: "()".into(),
+            signature: "() -> void".into(),
             statements: Some(vec![
                 "show();".into(),
                 "slint::run_event_loop();".into(),
@@ -1836,7 +1950,7 @@ fn generate_public_api_for_properties(
             ];
             declarations.push(Declaration::Function(Function {
                 name: format!("set_{}", &prop_ident),
-                signature: format!("(const {} &value) const", &cpp_property_type),
+                signature: format!("(const {} &value) const -> void", &cpp_property_type),
                 statements: Some(prop_setter),
                 ..Default::default()
             }));
@@ -729,12 +729,65 @@ pub fn invoke_from_event_loop(func: impl FnOnce() + Send + 'static) -> Result<()
 /// to be called from callbacks triggered by the UI. After calling the function,
 /// it will return immediately and once control is passed back to the event loop,
 /// the initial call to `slint::run_event_loop()` will return.
+///
+/// When called from a thread that runs its own event loop, see [`EventLoopContext`], it is that
+/// event loop that is terminated.
 pub fn quit_event_loop() -> Result<(), EventLoopError> {
+    #[cfg(feature = "std")]
+    if let Some(context) = EventLoopContext::current() {
+        return context.quit_event_loop();
+    }
     crate::platform::event_loop_proxy()
         .ok_or(EventLoopError::NoEventLoopProvider)?
         .quit_event_loop()
 }
 
+/// A handle to the event loop of a thread, that can be sent to other threads to run functions
+/// in that event loop.
+///
+/// Each thread that sets a platform runs its own event loop, with its own windows, timers and
+/// components, so that independent user interfaces, for example one on each display, run in
+/// parallel. [`invoke_from_event_loop()`] targets the main event loop, the one of the platform
+/// set with [`set_platform()`](crate::platform::set_platform), and an `EventLoopContext` the one of
+/// any thread, including the threads that called
+/// [`set_thread_platform()`](crate::platform::set_thread_platform).
+///
+/// The backends that use a windowing system only support one event loop, on the main thread. The
+/// other threads need a platform of their own, rendering with the software renderer.
+#[cfg(feature = "std")]
+#[derive(Clone)]
+pub struct EventLoopContext(alloc::sync::Arc<dyn crate::platform::EventLoopProxy>);
+
+#[cfg(feature = "std")]
+impl EventLoopContext {
+    pub(crate) fn new(proxy: alloc::sync::Arc<dyn crate::platform::EventLoopProxy>) -> Self {
+        Self(proxy)
+    }
+
+    /// Returns the event loop of the current thread, or None if no platform with an event loop
+    /// was set on this thread.
+    pub fn current() -> Option<Self> {
+        crate::platform::current_event_loop()
+    }
+
+    /// Adds `func` to the queue of this event loop, to be invoked from its thread.
+    ///
+    /// See also [`invoke_from_event_loop()`]
+    pub fn invoke_from_event_loop(
+        &self,
+        func: impl FnOnce() + Send + 'static,
+    ) -> Result<(), EventLoopError> {
+        self.0.invoke_from_event_loop(Box::new(func))
+    }
+
+    /// Schedules this event loop for termination.
+    ///
+    /// See also [`quit_event_loop()`]
+    pub fn quit_event_loop(&self) -> Result<(), EventLoopError> {
+        self.0.quit_event_loop()
+    }
+}
+
 #[derive(Debug, Clone, Eq, PartialEq)]
 #[non_exhaustive]
 /// Error returned from the [`invoke_from_event_loop()`] and [`quit_event_loop()`] function
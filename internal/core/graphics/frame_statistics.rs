@@ -0,0 +1,222 @@
+// Copyright © SixtyFPS GmbH <info@slint-ui.com>
+// SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-Slint-commercial
+
+/*!
+This module collects statistics about each rendered frame, for windows that enabled it with
+[`WindowInner::set_frame_statistics_history_size`](crate::window::WindowInner::set_frame_statistics_history_size)
+or [`WindowInner::set_frame_statistics_callback`](crate::window::WindowInner::set_frame_statistics_callback).
+
+The renderers and the property system report to the collector of the current thread, which is
+only active while a window that records statistics draws its contents. The reports first check a
+global counter of the active collectors, so that they cost a single atomic load when no window
+records statistics.
+*/
+
+use core::cell::Cell;
+use core::sync::atomic::{AtomicUsize, Ordering};
+use std::collections::VecDeque;
+
+/// The statistics of one rendered frame
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default, PartialEq, Eq)]
+pub struct FrameStatistics {
+    /// The wall-clock time spent rendering the scene, in nanoseconds
+    pub frame_time_ns: u64,
+    /// The time spent evaluating bindings while rendering, which includes the layouts, in
+    /// nanoseconds
+    pub binding_time_ns: u64,
+    /// The number of items visited while traversing the item tree
+    pub items_visited: u64,
+    /// The number of items that were drawn, i.e. not clipped away
+    pub items_drawn: u64,
+    /// The area of the region that was redrawn, in physical pixels. Renderers that always
+    /// redraw everything report the area of the window.
+    pub dirty_region_area: u64,
+    /// The number of images that were uploaded to textures
+    pub texture_uploads: u64,
+}
+
+#[derive(Default)]
+struct Collector {
+    active: Cell<bool>,
+    binding_depth: Cell<u32>,
+    binding_time: Cell<core::time::Duration>,
+    items_visited: Cell<u64>,
+    items_drawn: Cell<u64>,
+    dirty_region_area: Cell<Option<u64>>,
+    texture_uploads: Cell<u64>,
+}
+
+thread_local!(static COLLECTOR: Collector = Default::default());
+
+/// The number of calls to collect_frame() in progress, in all threads
+static ACTIVE_COLLECTORS: AtomicUsize = AtomicUsize::new(0);
+
+/// Returns false if no thread is collecting the statistics of a frame, in which case the
+/// collector of the current thread doesn't need to be looked at.
+#[inline]
+fn any_collector_active() -> bool {
+    ACTIVE_COLLECTORS.load(Ordering::Relaxed) != 0
+}
+
+/// Collects the statistics of the frame rendered by `render`. `window_area` is the dirty region
+/// area reported if the renderer doesn't report one.
+pub(crate) fn collect_frame(window_area: u64, render: impl FnOnce()) -> FrameStatistics {
+    struct ActiveGuard;
+    impl Drop for ActiveGuard {
+        fn drop(&mut self) {
+            ACTIVE_COLLECTORS.fetch_sub(1, Ordering::Relaxed);
+        }
+    }
+    ACTIVE_COLLECTORS.fetch_add(1, Ordering::Relaxed);
+    let _guard = ActiveGuard;
+    let was_active = COLLECTOR.with(|c| {
+        c.binding_time.set(Default::default());
+        c.items_visited.set(0);
+        c.items_drawn.set(0);
+        c.dirty_region_area.set(None);
+        c.texture_uploads.set(0);
+        c.active.replace(true)
+    });
+    let start = instant::Instant::now();
+    render();
+    let frame_time = start.elapsed();
+    COLLECTOR.with(|c| {
+        c.active.set(was_active);
+        FrameStatistics {
+            frame_time_ns: frame_time.as_nanos() as u64,
+            binding_time_ns: c.binding_time.get().as_nanos() as u64,
+            items_visited: c.items_visited.get(),
+            items_drawn: c.items_drawn.get(),
+            dirty_region_area: c.dirty_region_area.get().unwrap_or(window_area),
+            texture_uploads: c.texture_uploads.get(),
+        }
+    })
+}
+
+/// Measures the time spent in `evaluate`, if a frame is being collected. Nested evaluations are
+/// only counted once.
+#[inline]
+pub(crate) fn measure_binding<R>(evaluate: impl FnOnce() -> R) -> R {
+    if !any_collector_active() {
+        return evaluate();
+    }
+    let outermost = COLLECTOR.with(|c| {
+        if c.active.get() {
+            Some(c.binding_depth.replace(c.binding_depth.get() + 1) == 0)
+        } else {
+            None
+        }
+    });
+    let start = match outermost {
+        None => return evaluate(),
+        Some(outermost) => outermost.then(instant::Instant::now),
+    };
+    let result = evaluate();
+    COLLECTOR.with(|c| {
+        c.binding_depth.set(c.binding_depth.get() - 1);
+        if let Some(start) = start {
+            c.binding_time.set(c.binding_time.get() + start.elapsed());
+        }
+    });
+    result
+}
+
+/// Called by render_item_children for each visited item
+pub(crate) fn record_item(drawn: bool) {
+    if !any_collector_active() {
+        return;
+    }
+    COLLECTOR.with(|c| {
+        if c.active.get() {
+            c.items_visited.set(c.items_visited.get() + 1);
+            if drawn {
+                c.items_drawn.set(c.items_drawn.get() + 1);
+            }
+        }
+    })
+}
+
+/// Renderers that only redraw part of the window report the area they redrew, in physical pixels
+pub fn record_dirty_region_area(area: u64) {
+    if !any_collector_active() {
+        return;
+    }
+    COLLECTOR.with(|c| {
+        if c.active.get() {
+            c.dirty_region_area.set(Some(c.dirty_region_area.get().unwrap_or(0) + area));
+        }
+    })
+}
+
+/// Renderers report each image that they upload to a texture
+pub fn record_texture_upload() {
+    if !any_collector_active() {
+        return;
+    }
+    COLLECTOR.with(|c| {
+        if c.active.get() {
+            c.texture_uploads.set(c.texture_uploads.get() + 1);
+        }
+    })
+}
+
+/// The statistics kept by a window
+#[derive(Default)]
+pub(crate) struct FrameStatisticsRecorder {
+    pub history: VecDeque<FrameStatistics>,
+    pub history_size: usize,
+    pub callback: Option<Box<dyn FnMut(&FrameStatistics)>>,
+}
+
+impl FrameStatisticsRecorder {
+    pub fn is_enabled(&self) -> bool {
+        self.history_size > 0 || self.callback.is_some()
+    }
+
+    /// Adds a frame to the history, dropping the oldest one if the history is full
+    pub fn record(&mut self, frame: FrameStatistics) {
+        if self.history_size > 0 {
+            if self.history.len() == self.history_size {
+                self.history.pop_front();
+            }
+            self.history.push_back(frame);
+        }
+    }
+}
+
+#[test]
+fn collect_frame_statistics() {
+    let prop = Box::pin(crate::Property::new(0));
+    prop.set_binding(|| {
+        std::thread::sleep(core::time::Duration::from_millis(2));
+        42
+    });
+
+    // Nothing is recorded outside of a frame
+    record_item(true);
+    record_texture_upload();
+
+    let statistics = collect_frame(100, || {
+        assert_eq!(prop.as_ref().get(), 42);
+        record_item(true);
+        record_item(false);
+        record_item(true);
+        record_texture_upload();
+    });
+    assert!(statistics.binding_time_ns >= 2_000_000);
+    assert!(statistics.frame_time_ns >= statistics.binding_time_ns);
+    assert_eq!(statistics.items_visited, 3);
+    assert_eq!(statistics.items_drawn, 2);
+    assert_eq!(statistics.dirty_region_area, 100);
+    assert_eq!(statistics.texture_uploads, 1);
+
+    let statistics = collect_frame(100, || {
+        record_dirty_region_area(10);
+        record_dirty_region_area(20);
+    });
+    assert_eq!(statistics.binding_time_ns, 0);
+    assert_eq!(statistics.items_visited, 0);
+    assert_eq!(statistics.dirty_region_area, 30);
+    assert_eq!(statistics.texture_uploads, 0);
+}
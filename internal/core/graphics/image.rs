@@ -284,6 +284,32 @@ pub struct StaticTextures {
     pub textures: Slice<'static, StaticTexture>,
 }
 
+/// Where the first row of the pixels of a texture borrowed with
+/// [`Image::from_borrowed_gl_2d_rgba_texture`] is displayed.
+#[repr(u8)]
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub enum BorrowedOpenGLTextureOrigin {
+    /// The first row of the texture is the top of the image. This is the layout of the pixels
+    /// uploaded with `glTexImage2D` from an image in memory.
+    TopLeft,
+    /// The first row of the texture is the bottom of the image. This is the layout of the
+    /// textures that OpenGL renders into, for example through a framebuffer object.
+    BottomLeft,
+}
+
+/// An OpenGL texture that is owned by the application and displayed as an image, see
+/// [`Image::from_borrowed_gl_2d_rgba_texture`].
+#[repr(C)]
+#[derive(Clone, Debug, PartialEq)]
+pub struct BorrowedOpenGLTexture {
+    /// The name of the `GL_TEXTURE_2D` texture
+    pub texture_id: core::num::NonZeroU32,
+    /// The size of the texture in pixels
+    pub size: IntSize,
+    /// How the rows of the texture are laid out
+    pub origin: BorrowedOpenGLTextureOrigin,
+}
+
 /// ImageCacheKey encapsulates the different ways of indexing images in the
 /// cache of decoded images.
 #[derive(PartialEq, Eq, Debug, Hash, Clone)]
@@ -316,6 +342,8 @@ pub fn new(resource: &ImageInner) -> Option<Self> {
             #[cfg(target_arch = "wasm32")]
             ImageInner::HTMLImage(htmlimage) => Self::URL(htmlimage.source().into()),
             ImageInner::BackendStorage(x) => vtable::VRc::borrow(x).cache_key(),
+            // The contents of the texture can change at any time
+            ImageInner::BorrowedOpenGLTexture(..) => return None,
         };
         if matches!(key, ImageCacheKey::Invalid) {
             None
@@ -350,6 +378,7 @@ pub enum ImageInner {
     #[cfg(target_arch = "wasm32")]
     HTMLImage(vtable::VRc<OpaqueImageVTable, htmlimage::HTMLImage>),
     BackendStorage(vtable::VRc<OpaqueImageVTable>),
+    BorrowedOpenGLTexture(BorrowedOpenGLTexture),
 }
 
 impl ImageInner {
@@ -459,6 +488,7 @@ fn eq(&self, other: &Self) -> bool {
             #[cfg(feature = "svg")]
             (Self::Svg(l0), Self::Svg(r0)) => vtable::VRc::ptr_eq(l0, r0),
             (Self::StaticTextures(l0), Self::StaticTextures(r0)) => l0 == r0,
+            (Self::BorrowedOpenGLTexture(l0), Self::BorrowedOpenGLTexture(r0)) => l0 == r0,
             #[cfg(target_arch = "wasm32")]
             (Self::HTMLImage(l0), Self::HTMLImage(r0)) => vtable::VRc::ptr_eq(l0, r0),
             _ => core::mem::discriminant(self) == core::mem::discriminant(other),
@@ -602,6 +632,32 @@ pub fn from_rgba8_premultiplied(buffer: SharedPixelBuffer<Rgba8Pixel>) -> Self {
         })
     }
 
+    /// Creates a new Image that displays the existing OpenGL texture `texture_id`, without copying
+    /// its pixels to the CPU. The texture must be a `GL_TEXTURE_2D` texture of `size` pixels with
+    /// an RGBA format, and `origin` tells whether its first row is the top or the bottom of the
+    /// image.
+    ///
+    /// The texture is read each time a frame is rendered. After changing its contents, call
+    /// [`Window::request_redraw()`](crate::api::Window::request_redraw) to display them.
+    ///
+    /// Only the FemtoVG renderer supports these images, outside of WebAssembly. It copies the
+    /// texture to the window on the GPU, replacing the pixels below instead of blending with them,
+    /// so the image is not drawn when it has an opacity, is in a clip with a border radius or in a
+    /// layer, and fills its bounding box when it's rotated. The other renderers display nothing.
+    ///
+    /// # Safety
+    ///
+    /// The texture must belong to the OpenGL context of the window the image is displayed in, or to
+    /// a context that shares its textures with it. It must remain valid, with the same size, until
+    /// the image and all its copies are dropped.
+    pub unsafe fn from_borrowed_gl_2d_rgba_texture(
+        texture_id: core::num::NonZeroU32,
+        size: IntSize,
+        origin: BorrowedOpenGLTextureOrigin,
+    ) -> Self {
+        Image(ImageInner::BorrowedOpenGLTexture(BorrowedOpenGLTexture { texture_id, size, origin }))
+    }
+
     /// Returns the size of the Image in pixels.
     pub fn size(&self) -> IntSize {
         match &self.0 {
@@ -613,6 +669,7 @@ pub fn size(&self) -> IntSize {
             #[cfg(target_arch = "wasm32")]
             ImageInner::HTMLImage(htmlimage) => htmlimage.size().unwrap_or_default(),
             ImageInner::BackendStorage(x) => vtable::VRc::borrow(x).size(),
+            ImageInner::BorrowedOpenGLTexture(texture) => texture.size,
         }
     }
 
@@ -663,6 +720,19 @@ fn test_image_size_from_buffer_without_backend() {
         let image = Image::from_rgb8(buffer);
         assert_eq!(image.size(), [320, 200].into())
     }
+    {
+        let texture_id = core::num::NonZeroU32::new(42).unwrap();
+        let image = unsafe {
+            Image::from_borrowed_gl_2d_rgba_texture(
+                texture_id,
+                [64, 48].into(),
+                BorrowedOpenGLTextureOrigin::BottomLeft,
+            )
+        };
+        assert_eq!(image.size(), [64, 48].into());
+        assert_eq!(ImageCacheKey::new(&image.0), None);
+        assert_eq!(image.clone(), image);
+    }
 }
 
 /// Return an size that can be used to render an image in a buffer that matches a given ImageFit
@@ -703,6 +773,7 @@ struct Rgba8Pixel {
         r: u8,
         g: u8,
         b: u8,
+        a: u8,
     }
 
     #[no_mangle]
@@ -722,6 +793,28 @@ struct Rgba8Pixel {
         std::ptr::write(image, super::load_image_from_embedded_data(data, format));
     }
 
+    /// Decodes the image at `path`, downscaled to fit in `max_width` x `max_height` unless
+    /// they are 0. Can be called from any thread.
+    #[no_mangle]
+    pub unsafe extern "C" fn slint_image_decode_from_path(
+        path: &SharedString,
+        max_width: u32,
+        max_height: u32,
+        image: *mut Image,
+    ) {
+        let max_size =
+            (max_width > 0 && max_height > 0).then(|| IntSize::new(max_width, max_height));
+        std::ptr::write(
+            image,
+            super::cache::decode_image_from_path(path, max_size).unwrap_or_default(),
+        )
+    }
+
+    #[no_mangle]
+    pub unsafe extern "C" fn slint_image_set_decoded_cache_budget(bytes: usize) {
+        super::cache::set_decoded_image_cache_budget(bytes)
+    }
+
     #[no_mangle]
     pub unsafe extern "C" fn slint_image_size(image: &Image) -> IntSize {
         image.size()
@@ -6,25 +6,31 @@
 */
 
 use super::{Image, ImageCacheKey, ImageInner, SharedImageBuffer, SharedPixelBuffer};
+use crate::graphics::IntSize;
 use crate::{slice::Slice, SharedString};
 
 struct ImageWeightInBytes;
 
+fn buffer_weight(buffer: &SharedImageBuffer) -> usize {
+    match buffer {
+        SharedImageBuffer::RGB8(pixels) => pixels.as_bytes().len(),
+        SharedImageBuffer::RGBA8(pixels) => pixels.as_bytes().len(),
+        SharedImageBuffer::RGBA8Premultiplied(pixels) => pixels.as_bytes().len(),
+    }
+}
+
 impl clru::WeightScale<ImageCacheKey, ImageInner> for ImageWeightInBytes {
     fn weight(&self, _: &ImageCacheKey, value: &ImageInner) -> usize {
         match value {
             ImageInner::None => 0,
-            ImageInner::EmbeddedImage { buffer, .. } => match buffer {
-                SharedImageBuffer::RGB8(pixels) => pixels.as_bytes().len(),
-                SharedImageBuffer::RGBA8(pixels) => pixels.as_bytes().len(),
-                SharedImageBuffer::RGBA8Premultiplied(pixels) => pixels.as_bytes().len(),
-            },
+            ImageInner::EmbeddedImage { buffer, .. } => buffer_weight(buffer),
             #[cfg(feature = "svg")]
             ImageInner::Svg(_) => 512, // Don't know how to measure the size of the parsed SVG tree...
             #[cfg(target_arch = "wasm32")]
             ImageInner::HTMLImage(_) => 512, // Something... the web browser maintainers its own cache. The purpose of this cache is to reduce the amount of DOM elements.
             ImageInner::StaticTextures(_) => 0,
             ImageInner::BackendStorage(x) => vtable::VRc::borrow(x).size().area() as usize,
+            ImageInner::BorrowedOpenGLTexture(..) => 0, // The application owns the texture
         }
     }
 }
@@ -178,3 +184,123 @@ pub fn replace_cached_image(key: ImageCacheKey, value: ImageInner) {
     let _ =
         IMAGE_CACHE.with(|global_cache| global_cache.borrow_mut().0.put_with_weight(key, value));
 }
+
+/// Key of the process-wide cache of decoded images: the same file decoded for different maximum
+/// sizes results in different entries.
+#[derive(PartialEq, Eq, Hash, Clone)]
+struct DecodedImageKey {
+    path: SharedString,
+    max_size: Option<IntSize>,
+}
+
+impl DecodedImageKey {
+    fn to_image(&self, buffer: SharedImageBuffer) -> Image {
+        // Only an image at its original size may be shared with images loaded from the same path
+        let cache_key = match self.max_size {
+            None => ImageCacheKey::Path(self.path.clone()),
+            Some(_) => ImageCacheKey::Invalid,
+        };
+        Image(ImageInner::EmbeddedImage { cache_key, buffer })
+    }
+}
+
+/// Cache used by decode_image_from_path(), shared by all threads. It only holds pixel buffers,
+/// which, unlike the ImageInner values of IMAGE_CACHE, can be sent across threads.
+struct DecodedImageCache {
+    entries: std::collections::HashMap<DecodedImageKey, (SharedImageBuffer, u64)>,
+    /// Incremented on each access, the entries with the lowest value are evicted first
+    clock: u64,
+    weight: usize,
+    budget: usize,
+}
+
+impl DecodedImageCache {
+    fn get(&mut self, key: &DecodedImageKey) -> Option<SharedImageBuffer> {
+        self.clock += 1;
+        let clock = self.clock;
+        self.entries.get_mut(key).map(|(buffer, last_use)| {
+            *last_use = clock;
+            buffer.clone()
+        })
+    }
+
+    fn put(&mut self, key: DecodedImageKey, buffer: SharedImageBuffer) {
+        let weight = buffer_weight(&buffer);
+        if weight > self.budget {
+            return;
+        }
+        self.clock += 1;
+        if let Some((old, _)) = self.entries.insert(key, (buffer, self.clock)) {
+            self.weight -= buffer_weight(&old);
+        }
+        self.weight += weight;
+        self.evict();
+    }
+
+    fn evict(&mut self) {
+        while self.weight > self.budget {
+            let oldest = match self.entries.iter().min_by_key(|(_, (_, last_use))| *last_use) {
+                Some((key, _)) => key.clone(),
+                None => break,
+            };
+            if let Some((buffer, _)) = self.entries.remove(&oldest) {
+                self.weight -= buffer_weight(&buffer);
+            }
+        }
+    }
+}
+
+/// Default budget of the process-wide cache of decoded images, in bytes.
+const DEFAULT_DECODED_IMAGE_CACHE_BUDGET: usize = 32 * 1024 * 1024;
+
+static DECODED_IMAGE_CACHE: once_cell::sync::Lazy<std::sync::Mutex<DecodedImageCache>> =
+    once_cell::sync::Lazy::new(|| {
+        std::sync::Mutex::new(DecodedImageCache {
+            entries: Default::default(),
+            clock: 0,
+            weight: 0,
+            budget: DEFAULT_DECODED_IMAGE_CACHE_BUDGET,
+        })
+    });
+
+/// Decodes the image file at `path` into a pixel buffer. If `max_size` is set and the image is
+/// larger, it is downscaled after decoding to fit in `max_size`, preserving its aspect ratio. The
+/// full resolution pixels are only kept in memory while the image is decoded.
+///
+/// In contrast to [`Image::load_from_path`], this function can be called from any thread, so that
+/// decoding doesn't block the event loop. Decoded images are kept in a process-wide cache,
+/// keyed on the path and `max_size`, whose least recently used entries are evicted once their
+/// total size exceeds the budget set with [`set_decoded_image_cache_budget`].
+///
+/// SVG files are not supported by this function.
+pub fn decode_image_from_path(path: &SharedString, max_size: Option<IntSize>) -> Option<Image> {
+    if path.is_empty() {
+        return None;
+    }
+    let key = DecodedImageKey { path: path.clone(), max_size };
+    if let Some(buffer) = DECODED_IMAGE_CACHE.lock().unwrap().get(&key) {
+        return Some(key.to_image(buffer));
+    }
+
+    // Decode without holding the lock, so that several threads can decode at the same time
+    let mut image = image::open(std::path::Path::new(path.as_str()))
+        .map_err(|decode_err| eprintln!("Error loading image from {}: {}", &path, decode_err))
+        .ok()?;
+    if let Some(max_size) = max_size {
+        if image.width() > max_size.width || image.height() > max_size.height {
+            image = image.thumbnail(max_size.width, max_size.height);
+        }
+    }
+    let buffer = dynamic_image_to_shared_image_buffer(image);
+    DECODED_IMAGE_CACHE.lock().unwrap().put(key.clone(), buffer.clone());
+    Some(key.to_image(buffer))
+}
+
+/// Sets the maximum number of bytes of pixel data kept by the cache of images decoded with
+/// [`decode_image_from_path`]. Entries are evicted, least recently used first, until the cache
+/// fits. A budget of 0 disables the cache.
+pub fn set_decoded_image_cache_budget(bytes: usize) {
+    let mut cache = DECODED_IMAGE_CACHE.lock().unwrap();
+    cache.budget = bytes;
+    cache.evict();
+}
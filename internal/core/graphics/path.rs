@@ -314,6 +314,147 @@ pub fn iter(self) -> PathDataIterator {
         }
     }
 
+    /// Returns the events and the coordinates of the path, converting the elements or the
+    /// commands.
+    fn into_events(
+        self,
+    ) -> (crate::SharedVector<PathEvent>, crate::SharedVector<lyon_path::math::Point>) {
+        use lyon_path::Event;
+        match self {
+            PathData::Events(events, coordinates) => (events, coordinates),
+            PathData::None => Default::default(),
+            other => {
+                let mut events = crate::SharedVector::default();
+                let mut coordinates = crate::SharedVector::default();
+                for event in other.iter().iter() {
+                    match event {
+                        Event::Begin { at } => {
+                            events.push(PathEvent::Begin);
+                            coordinates.push(at);
+                        }
+                        Event::Line { from, to } => {
+                            events.push(PathEvent::Line);
+                            coordinates.push(from);
+                            coordinates.push(to);
+                        }
+                        Event::Quadratic { from, ctrl, to } => {
+                            events.push(PathEvent::Quadratic);
+                            coordinates.push(from);
+                            coordinates.push(ctrl);
+                            coordinates.push(to);
+                        }
+                        Event::Cubic { from, ctrl1, ctrl2, to } => {
+                            events.push(PathEvent::Cubic);
+                            coordinates.push(from);
+                            coordinates.push(ctrl1);
+                            coordinates.push(ctrl2);
+                            coordinates.push(to);
+                        }
+                        Event::End { close, .. } => events.push(if close {
+                            PathEvent::EndClosed
+                        } else {
+                            PathEvent::EndOpen
+                        }),
+                    }
+                }
+                (events, coordinates)
+            }
+        }
+    }
+
+    /// Appends lines through `points` to the path. If the path ends with a sub-path that remains
+    /// open, the lines continue it, otherwise they start a new sub-path at the first point.
+    ///
+    /// The path is converted to events if it was made of elements or commands. The existing
+    /// events and coordinates are extended in place, and only copied if they are shared with
+    /// another `PathData`.
+    pub fn append_polyline(&mut self, points: &[lyon_path::math::Point]) {
+        if points.is_empty() {
+            return;
+        }
+        let (mut events, mut coordinates) = core::mem::take(self).into_events();
+        let mut points = points.iter().copied();
+        let continues_open_sub_path = events.as_slice().last() == Some(&PathEvent::EndOpen);
+        let mut last = match coordinates.as_slice().last().copied() {
+            Some(last) if continues_open_sub_path => {
+                events.resize(events.len() - 1, PathEvent::EndOpen);
+                last
+            }
+            _ => {
+                let first = points.next().unwrap();
+                events.push(PathEvent::Begin);
+                coordinates.push(first);
+                first
+            }
+        };
+        for point in points {
+            events.push(PathEvent::Line);
+            coordinates.push(last);
+            coordinates.push(point);
+            last = point;
+        }
+        events.push(PathEvent::EndOpen);
+        *self = PathData::Events(events, coordinates);
+    }
+
+    /// Returns a path with lines through the `points` of a polyline sorted by x, reduced to at
+    /// most four points for each of the `columns` columns that divide the range from `min_x`
+    /// to `max_x`: the first, the lowest, the highest and the last point of the column, in
+    /// their order. Drawing the result over `columns` pixels looks like drawing every point,
+    /// but the cost depends on the number of columns instead of the number of points.
+    ///
+    /// The points outside of the range are dropped, except the nearest one on each side so that
+    /// the lines still reach the edges of the range.
+    pub fn decimated_polyline(
+        points: &[lyon_path::math::Point],
+        min_x: f32,
+        max_x: f32,
+        columns: usize,
+    ) -> PathData {
+        let mut path = PathData::None;
+        if columns == 0 || !(max_x > min_x) {
+            return path;
+        }
+        let start = points.partition_point(|p| p.x < min_x);
+        let end = points.partition_point(|p| p.x <= max_x);
+        let column_width = (max_x - min_x) / columns as f32;
+        let column_of =
+            |p: &lyon_path::math::Point| (((p.x - min_x) / column_width) as usize).min(columns - 1);
+
+        let mut decimated = alloc::vec::Vec::with_capacity(4 * (end - start).min(columns) + 2);
+        if start > 0 {
+            decimated.push(points[start - 1]);
+        }
+        let mut i = start;
+        while i < end {
+            let column = column_of(&points[i]);
+            let first = i;
+            let (mut lowest, mut highest) = (i, i);
+            i += 1;
+            while i < end && column_of(&points[i]) == column {
+                if points[i].y < points[lowest].y {
+                    lowest = i;
+                }
+                if points[i].y > points[highest].y {
+                    highest = i;
+                }
+                i += 1;
+            }
+            let mut indices = [first, lowest, highest, i - 1];
+            indices.sort_unstable();
+            for (n, index) in indices.iter().enumerate() {
+                if n == 0 || *index != indices[n - 1] {
+                    decimated.push(points[*index]);
+                }
+            }
+        }
+        if end < points.len() {
+            decimated.push(points[end]);
+        }
+        path.append_polyline(&decimated);
+        path
+    }
+
     fn build_path(element_it: core::slice::Iter<PathElement>) -> lyon_path::Path {
         use lyon_geom::SvgArc;
         use lyon_path::math::{Angle, Point, Vector};
@@ -425,4 +566,75 @@ pub(crate) mod ffi {
         ));
         core::ptr::write(out_coordinates as *mut crate::SharedVector<Point>, coordinates);
     }
+
+    #[no_mangle]
+    /// This function is used for the low-level C++ interface to append lines to a path.
+    pub unsafe extern "C" fn slint_path_data_append_polyline(
+        path: &mut PathData,
+        first_point: *const Point,
+        count: usize,
+    ) {
+        path.append_polyline(core::slice::from_raw_parts(
+            first_point as *const lyon_path::math::Point,
+            count,
+        ));
+    }
+
+    #[no_mangle]
+    /// This function is used for the low-level C++ interface to create a decimated polyline.
+    pub unsafe extern "C" fn slint_path_data_decimated_polyline(
+        out: *mut PathData,
+        first_point: *const Point,
+        count: usize,
+        min_x: f32,
+        max_x: f32,
+        columns: usize,
+    ) {
+        let points =
+            core::slice::from_raw_parts(first_point as *const lyon_path::math::Point, count);
+        core::ptr::write(out, PathData::decimated_polyline(points, min_x, max_x, columns));
+    }
+}
+
+#[test]
+fn append_and_decimate_polyline() {
+    use lyon_path::math::point;
+
+    fn events_and_coordinates(
+        path: PathData,
+    ) -> (alloc::vec::Vec<PathEvent>, alloc::vec::Vec<lyon_path::math::Point>) {
+        match path {
+            PathData::Events(events, coordinates) => {
+                (events.as_slice().to_vec(), coordinates.as_slice().to_vec())
+            }
+            _ => panic!("the path is not made of events"),
+        }
+    }
+
+    let mut path = PathData::default();
+    path.append_polyline(&[point(0., 0.), point(1., 1.)]);
+    path.append_polyline(&[point(2., 0.)]);
+    let (events, coordinates) = events_and_coordinates(path);
+    assert_eq!(events, [PathEvent::Begin, PathEvent::Line, PathEvent::Line, PathEvent::EndOpen]);
+    assert_eq!(
+        coordinates,
+        [point(0., 0.), point(0., 0.), point(1., 1.), point(1., 1.), point(2., 0.)]
+    );
+
+    // 1000 points in 10 columns, with the lowest point of the first column in its middle
+    let points = (0..1000)
+        .map(|i| point(i as f32 / 100., if i == 50 { -5. } else { (i % 7) as f32 }))
+        .collect::<alloc::vec::Vec<_>>();
+    let (events, coordinates) =
+        events_and_coordinates(PathData::decimated_polyline(&points, 0., 10., 10));
+    assert!(events.len() <= 10 * 4 + 1);
+    assert_eq!(coordinates[0], points[0]);
+    // the first column goes through its highest, lowest and last points
+    assert_eq!(
+        &coordinates[2..7].iter().step_by(2).copied().collect::<alloc::vec::Vec<_>>(),
+        &[points[6], points[50], points[99]]
+    );
+    assert_eq!(*coordinates.last().unwrap(), points[999]);
+
+    assert_eq!(PathData::decimated_polyline(&points, 0., 10., 0), PathData::None);
 }
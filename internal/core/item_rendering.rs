@@ -173,6 +173,8 @@ pub fn render_item_children(
             renderer.save_state();
 
             let (do_draw, item_geometry) = renderer.filter_item(item);
+            #[cfg(feature = "std")]
+            crate::graphics::frame_statistics::record_item(do_draw);
 
             let item_origin = item_geometry.origin;
             renderer.translate(item_origin.to_vector());
@@ -391,11 +391,19 @@ pub struct GridLayoutCellData {
 
 /// return, an array which is of size `data.cells.len() * 2` which for each cell we give the pos, size
 pub fn solve_grid_layout(data: &GridLayoutData) -> SharedVector<Coord> {
+    let mut result = SharedVector::default();
+    solve_grid_layout_into(data, &mut result);
+    result
+}
+
+/// Like [`solve_grid_layout`], but writes into `result`, reusing its memory if it isn't shared
+pub fn solve_grid_layout_into(data: &GridLayoutData, result: &mut SharedVector<Coord>) {
+    result.clear();
     let mut layout_data =
         grid_internal::to_layout_data(data.cells.as_slice(), data.spacing, Some(data.size));
 
     if layout_data.is_empty() {
-        return Default::default();
+        return;
     }
 
     grid_internal::layout_items(
@@ -405,17 +413,13 @@ pub fn solve_grid_layout(data: &GridLayoutData) -> SharedVector<Coord> {
         data.spacing,
     );
 
-    let mut result = SharedVector::with_capacity(4 * data.cells.len());
-    for cell in data.cells.iter() {
-        let cdata = &layout_data[cell.col_or_row as usize];
-        result.push(cdata.pos);
-        result.push({
-            let first_cell = &layout_data[cell.col_or_row as usize];
-            let last_cell = &layout_data[cell.col_or_row as usize + cell.span as usize - 1];
-            last_cell.pos + last_cell.size - first_cell.pos
-        });
+    result.resize(2 * data.cells.len(), 0 as _);
+    for (cell, res) in data.cells.iter().zip(result.make_mut_slice().chunks_mut(2)) {
+        let first_cell = &layout_data[cell.col_or_row as usize];
+        let last_cell = &layout_data[cell.col_or_row as usize + cell.span as usize - 1];
+        res[0] = first_cell.pos;
+        res[1] = last_cell.pos + last_cell.size - first_cell.pos;
     }
-    result
 }
 
 pub fn grid_layout_info(
@@ -457,10 +461,21 @@ pub struct BoxLayoutCellData {
 /// Solve a BoxLayout
 pub fn solve_box_layout(data: &BoxLayoutData, repeater_indexes: Slice<u32>) -> SharedVector<Coord> {
     let mut result = SharedVector::<Coord>::default();
+    solve_box_layout_into(data, repeater_indexes, &mut result);
+    result
+}
+
+/// Like [`solve_box_layout`], but writes into `result`, reusing its memory if it isn't shared
+pub fn solve_box_layout_into(
+    data: &BoxLayoutData,
+    repeater_indexes: Slice<u32>,
+    result: &mut SharedVector<Coord>,
+) {
+    result.clear();
     result.resize(data.cells.len() * 2 + repeater_indexes.len(), 0 as _);
 
     if data.cells.is_empty() {
-        return result;
+        return;
     }
 
     let mut layout_data: Vec<_> = data
@@ -561,7 +576,6 @@ pub fn solve_box_layout(data: &BoxLayoutData, repeater_indexes: Slice<u32>) -> S
         res[o * 2] = layout.pos;
         res[o * 2 + 1] = layout.size;
     }
-    result
 }
 
 /// Return the LayoutInfo for a BoxLayout with the given cells.
@@ -624,6 +638,18 @@ pub fn solve_path_layout(
     data: &PathLayoutData,
     repeater_indexes: Slice<u32>,
 ) -> SharedVector<Coord> {
+    let mut result = SharedVector::<Coord>::default();
+    solve_path_layout_into(data, repeater_indexes, &mut result);
+    result
+}
+
+/// Like [`solve_path_layout`], but writes into `result`, reusing its memory if it isn't shared
+#[cfg(feature = "std")]
+pub fn solve_path_layout_into(
+    data: &PathLayoutData,
+    repeater_indexes: Slice<u32>,
+    result: &mut SharedVector<Coord>,
+) {
     use lyon_geom::*;
     use lyon_path::PathEvent;
 
@@ -642,7 +668,7 @@ pub fn solve_path_layout(
         next_t += item_distance;
     }
 
-    let mut result = SharedVector::<Coord>::default();
+    result.clear();
     result.resize(data.item_count as usize * 2 + repeater_indexes.len(), 0 as Coord);
     let res = result.make_mut_slice();
 
@@ -731,8 +757,6 @@ pub fn solve_path_layout(
             }
         }
     }
-
-    result
 }
 
 /// Given the cells of a layout of a Dialog, re-order the button according to the platform
@@ -815,7 +839,7 @@ pub extern "C" fn slint_solve_grid_layout(
         data: &GridLayoutData,
         result: &mut SharedVector<Coord>,
     ) {
-        *result = super::solve_grid_layout(data)
+        super::solve_grid_layout_into(data, result)
     }
 
     #[no_mangle]
@@ -833,7 +857,7 @@ pub extern "C" fn slint_solve_box_layout(
         repeater_indexes: Slice<u32>,
         result: &mut SharedVector<Coord>,
     ) {
-        *result = super::solve_box_layout(data, repeater_indexes)
+        super::solve_box_layout_into(data, repeater_indexes, result)
     }
 
     #[no_mangle]
@@ -862,7 +886,7 @@ pub extern "C" fn slint_solve_path_layout(
         repeater_indexes: Slice<u32>,
         result: &mut SharedVector<Coord>,
     ) {
-        *result = super::solve_path_layout(data, repeater_indexes)
+        super::solve_path_layout_into(data, repeater_indexes, result)
     }
 
     /// Calls [`reorder_dialog_button_layout`].
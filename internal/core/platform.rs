@@ -114,12 +114,25 @@ fn from(our_instant: crate::animations::Instant) -> Self {
     pub(crate) static PLATFORM_INSTANCE : once_cell::unsync::OnceCell<Box<dyn Platform>>
         = once_cell::unsync::OnceCell::new()
 }
+/// The proxy of the platform set with [`set_platform()`], which runs the main event loop
 static EVENTLOOP_PROXY: OnceCell<Box<dyn EventLoopProxy + 'static>> = OnceCell::new();
 
 pub(crate) fn event_loop_proxy() -> Option<&'static dyn EventLoopProxy> {
     EVENTLOOP_PROXY.get().map(core::ops::Deref::deref)
 }
 
+#[cfg(feature = "std")]
+thread_local! {
+    /// The event loop of the platform set on the current thread
+    static CURRENT_EVENT_LOOP: once_cell::unsync::OnceCell<crate::api::EventLoopContext>
+        = once_cell::unsync::OnceCell::new()
+}
+
+#[cfg(feature = "std")]
+pub(crate) fn current_event_loop() -> Option<crate::api::EventLoopContext> {
+    CURRENT_EVENT_LOOP.with(|current| current.get().cloned())
+}
+
 /// This enum describes the different error scenarios that may occur when [`set_platform`]
 /// fails.
 #[derive(Debug, Clone)]
@@ -132,7 +145,13 @@ pub enum SetPlatformError {
 
 /// Set the Slint platform abstraction.
 ///
-/// If the platform abstraction was already set this will return `Err`.
+/// The platform is set for the current thread, which then owns the windows, timers and
+/// components it creates, and runs the main event loop, which
+/// [`invoke_from_event_loop()`](crate::api::invoke_from_event_loop) targets. Call this from the
+/// main thread. Other threads use [`set_thread_platform()`] to run an independent event loop.
+///
+/// If the platform abstraction was already set on this thread, or if another thread already runs
+/// the main event loop, this will return `Err`.
 pub fn set_platform(platform: Box<dyn Platform + 'static>) -> Result<(), SetPlatformError> {
     PLATFORM_INSTANCE.with(|instance| {
         if instance.get().is_some() {
@@ -141,11 +160,43 @@ pub fn set_platform(platform: Box<dyn Platform + 'static>) -> Result<(), SetPlat
         if let Some(proxy) = platform.new_event_loop_proxy() {
             EVENTLOOP_PROXY.set(proxy).map_err(|_| SetPlatformError::AlreadySet)?
         }
+        #[cfg(feature = "std")]
+        set_current_event_loop(&*platform);
+        instance.set(platform.into()).map_err(|_| SetPlatformError::AlreadySet).unwrap();
+        Ok(())
+    })
+}
+
+/// Set the Slint platform abstraction of the current thread, to run an event loop independent
+/// from the main event loop, with its own windows, timers and components. For example, each
+/// display of a device with several displays can be driven by its own thread.
+///
+/// The event loop of this thread is reachable through
+/// [`EventLoopContext::current()`](crate::api::EventLoopContext::current), while
+/// [`invoke_from_event_loop()`](crate::api::invoke_from_event_loop) keeps targeting the main
+/// event loop, the one of the platform set with [`set_platform()`].
+///
+/// If the platform abstraction was already set on this thread, this will return `Err`.
+#[cfg(feature = "std")]
+pub fn set_thread_platform(platform: Box<dyn Platform + 'static>) -> Result<(), SetPlatformError> {
+    PLATFORM_INSTANCE.with(|instance| {
+        if instance.get().is_some() {
+            return Err(SetPlatformError::AlreadySet);
+        }
+        set_current_event_loop(&*platform);
         instance.set(platform.into()).map_err(|_| SetPlatformError::AlreadySet).unwrap();
         Ok(())
     })
 }
 
+#[cfg(feature = "std")]
+fn set_current_event_loop(platform: &dyn Platform) {
+    if let Some(proxy) = platform.new_event_loop_proxy() {
+        let context = crate::api::EventLoopContext::new(proxy.into());
+        CURRENT_EVENT_LOOP.with(|current| current.set(context).ok());
+    }
+}
+
 /// Call this function to update and potentially activate any pending timers, as well
 /// as advance the state of any active animtaions.
 ///
@@ -173,3 +224,96 @@ pub fn duration_until_next_timer_update() -> Option<core::time::Duration> {
         )
     })
 }
+
+#[cfg(feature = "std")]
+#[test]
+fn event_loop_per_thread() {
+    use crate::api::{EventLoopContext, EventLoopError};
+    use std::sync::{mpsc, Mutex};
+
+    enum Event {
+        Invoke(Box<dyn FnOnce() + Send>),
+        Quit,
+    }
+    struct Proxy(Mutex<mpsc::Sender<Event>>);
+    impl EventLoopProxy for Proxy {
+        fn quit_event_loop(&self) -> Result<(), EventLoopError> {
+            self.0
+                .lock()
+                .unwrap()
+                .send(Event::Quit)
+                .map_err(|_| EventLoopError::EventLoopTerminated)
+        }
+        fn invoke_from_event_loop(
+            &self,
+            event: Box<dyn FnOnce() + Send>,
+        ) -> Result<(), EventLoopError> {
+            self.0
+                .lock()
+                .unwrap()
+                .send(Event::Invoke(event))
+                .map_err(|_| EventLoopError::EventLoopTerminated)
+        }
+    }
+    struct ChannelPlatform(mpsc::Sender<Event>, mpsc::Receiver<Event>);
+    impl ChannelPlatform {
+        fn new() -> Box<Self> {
+            let (sender, receiver) = mpsc::channel();
+            Box::new(Self(sender, receiver))
+        }
+    }
+    impl Platform for ChannelPlatform {
+        fn create_window_adapter(&self) -> Rc<dyn WindowAdapter> {
+            unimplemented!()
+        }
+        fn run_event_loop(&self) {
+            while let Ok(Event::Invoke(event)) = self.1.recv() {
+                event();
+            }
+        }
+        fn new_event_loop_proxy(&self) -> Option<Box<dyn EventLoopProxy>> {
+            Some(Box::new(Proxy(Mutex::new(self.0.clone()))))
+        }
+    }
+
+    let threads = (0..2)
+        .map(|_| {
+            let (context_sender, context_receiver) = mpsc::channel();
+            let thread = std::thread::spawn(move || {
+                set_thread_platform(ChannelPlatform::new()).unwrap();
+                assert!(matches!(
+                    set_thread_platform(ChannelPlatform::new()),
+                    Err(SetPlatformError::AlreadySet)
+                ));
+                context_sender.send(EventLoopContext::current().unwrap()).unwrap();
+                PLATFORM_INSTANCE.with(|p| p.get().unwrap().run_event_loop());
+            });
+            (context_receiver.recv().unwrap(), thread)
+        })
+        .collect::<Vec<_>>();
+    assert!(EventLoopContext::current().is_none());
+
+    let (result_sender, results) = mpsc::channel();
+    for (index, (context, _)) in threads.iter().enumerate() {
+        let result_sender = result_sender.clone();
+        context
+            .invoke_from_event_loop(move || {
+                result_sender.send((index, std::thread::current().id())).unwrap();
+                // Quits the event loop of this thread
+                crate::api::quit_event_loop().unwrap();
+            })
+            .unwrap();
+    }
+    drop(result_sender);
+    let ids = threads
+        .into_iter()
+        .map(|(_, thread)| {
+            let id = thread.thread().id();
+            thread.join().unwrap();
+            id
+        })
+        .collect::<Vec<_>>();
+    let mut results = results.iter().collect::<Vec<_>>();
+    results.sort_by_key(|(index, _)| *index);
+    assert_eq!(results, ids.into_iter().enumerate().collect::<Vec<_>>());
+}
@@ -356,6 +356,9 @@ struct BindingHolder<B = ()> {
     pinned: PhantomPinned,
     #[cfg(slint_debug_property)]
     pub debug_name: String,
+    /// The location of the code that set the binding, as reported by the binding profiler
+    #[cfg(feature = "binding-profiler")]
+    pub profiler_location: String,
 
     binding: B,
 }
@@ -377,6 +380,8 @@ fn register_self_as_dependency(
 fn alloc_binding_holder<B: BindingCallable + 'static>(binding: B) -> *mut BindingHolder {
     /// Safety: _self must be a pointer that comes from a `Box<BindingHolder<B>>::into_raw()`
     unsafe fn binding_drop<B>(_self: *mut BindingHolder) {
+        #[cfg(feature = "binding-profiler")]
+        profiler::forget_binding(_self);
         drop(Box::from_raw(_self as *mut BindingHolder<B>));
     }
 
@@ -435,6 +440,8 @@ impl<B: BindingCallable> HasBindingVTable for B {
         pinned: PhantomPinned,
         #[cfg(slint_debug_property)]
         debug_name: Default::default(),
+        #[cfg(feature = "binding-profiler")]
+        profiler_location: Default::default(),
         binding,
     };
     Box::into_raw(Box::new(holder)) as *mut BindingHolder
@@ -554,6 +561,16 @@ fn set_binding_impl(&self, binding: *mut BindingHolder) {
         }
     }
 
+    /// Sets the location reported by the binding profiler for the current binding, if any
+    #[cfg(feature = "binding-profiler")]
+    fn set_profiler_location(&self, location: String) {
+        self.access(|binding| {
+            if let Some(binding) = binding {
+                unsafe { binding.get_unchecked_mut().profiler_location = location };
+            }
+        })
+    }
+
     fn dependencies(&self) -> *mut DependencyListHead {
         assert!(!self.lock_flag(), "Recursion detected");
         if (self.handle.get() & 0b10) != 0 {
@@ -571,10 +588,15 @@ unsafe fn update<T>(&self, value: *mut T) {
                 if binding.dirty.get() {
                     // clear all the nodes so that we can start from scratch
                     binding.dep_nodes.set(Default::default());
-                    let r = (binding.vtable.evaluate)(
-                        binding.as_mut().get_unchecked_mut() as *mut BindingHolder,
-                        value as *mut (),
-                    );
+                    let evaluate = binding.vtable.evaluate;
+                    let binding_ptr = binding.as_mut().get_unchecked_mut() as *mut BindingHolder;
+                    let evaluate = || evaluate(binding_ptr, value as *mut ());
+                    #[cfg(feature = "binding-profiler")]
+                    let evaluate = || profiler::record_evaluation(&*binding_ptr, evaluate);
+                    #[cfg(feature = "std")]
+                    let r = crate::graphics::frame_statistics::measure_binding(evaluate);
+                    #[cfg(not(feature = "std"))]
+                    let r = evaluate();
                     binding.dirty.set(false);
                     if r == BindingResult::RemoveBinding {
                         return true;
@@ -601,6 +623,8 @@ fn register_as_dependency_to_current_binding(
                         unsafe { *(dependencies as *mut *const u32) },
                         (&CONSTANT_PROPERTY_SENTINEL) as *const u32,
                     ) {
+                        #[cfg(feature = "binding-profiler")]
+                        profiler::record_dependency(&cur_binding, &self);
                         cur_binding.register_self_as_dependency(
                             dependencies,
                             #[cfg(slint_debug_property)]
@@ -1452,5 +1476,8 @@ fn test_nested_property_tracker_evaluate_if_dirty() {
     assert_eq!(r, 12);
 }
 
+#[cfg(feature = "binding-profiler")]
+pub mod profiler;
+
 #[cfg(feature = "ffi")]
 pub(crate) mod ffi;
@@ -456,3 +456,51 @@ pub struct PropertyTrackerOpaque {
 pub extern "C" fn slint_animation_tick() -> u64 {
     crate::animations::animation_tick()
 }
+
+/// Set the location reported by the binding profiler for the binding of this property.
+/// `file` is a nul-terminated string.
+#[cfg(feature = "binding-profiler")]
+#[no_mangle]
+pub unsafe extern "C" fn slint_property_set_binding_location(
+    handle: &PropertyHandleOpaque,
+    file: *const std::os::raw::c_char,
+    line: u32,
+) {
+    let file = std::ffi::CStr::from_ptr(file).to_string_lossy();
+    handle.0.set_profiler_location(format!("{}:{}", file, line));
+}
+
+/// Start recording the evaluation of bindings on the current thread
+#[cfg(feature = "binding-profiler")]
+#[no_mangle]
+pub extern "C" fn slint_binding_profiler_start() {
+    super::profiler::start()
+}
+
+/// Stop recording the evaluation of bindings
+#[cfg(feature = "binding-profiler")]
+#[no_mangle]
+pub extern "C" fn slint_binding_profiler_stop() {
+    super::profiler::stop()
+}
+
+/// Discard the recorded evaluations
+#[cfg(feature = "binding-profiler")]
+#[no_mangle]
+pub extern "C" fn slint_binding_profiler_reset() {
+    super::profiler::reset()
+}
+
+/// Write the recorded evaluations in the Chrome trace event format to `out`
+#[cfg(feature = "binding-profiler")]
+#[no_mangle]
+pub extern "C" fn slint_binding_profiler_chrome_trace(out: &mut crate::SharedString) {
+    *out = super::profiler::chrome_trace().into();
+}
+
+/// Write the summary of the `max_rows` most expensive bindings to `out`
+#[cfg(feature = "binding-profiler")]
+#[no_mangle]
+pub extern "C" fn slint_binding_profiler_summary(max_rows: usize, out: &mut crate::SharedString) {
+    *out = super::profiler::summary(max_rows).into();
+}
@@ -0,0 +1,306 @@
+// Copyright © SixtyFPS GmbH <info@slint-ui.com>
+// SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-Slint-commercial
+
+/*!
+The binding profiler records each evaluation of a binding on the current thread, with its
+duration and the properties it depends on, to find the bindings that are evaluated more often
+than expected.
+
+It is only compiled in with the `binding-profiler` feature, and records nothing until [`start`]
+is called. The recording can be exported with [`chrome_trace`] to the JSON format understood by
+`chrome://tracing` and Perfetto, or summarized with [`summary`].
+*/
+
+use super::{BindingHolder, PropertyHandle};
+use core::cell::RefCell;
+use core::fmt::Write;
+use core::time::Duration;
+use std::collections::{BTreeSet, HashMap};
+
+/// A binding, or a property without binding that a binding depends on
+struct Node {
+    name: String,
+    evaluations: u64,
+    total_time: Duration,
+    self_time: Duration,
+    max_time: Duration,
+    dependencies: BTreeSet<usize>,
+}
+
+struct Evaluation {
+    node: usize,
+    start: Duration,
+    duration: Duration,
+}
+
+#[derive(Default)]
+struct Profiler {
+    start: Option<instant::Instant>,
+    recorded_time: Duration,
+    nodes: Vec<Node>,
+    /// Maps the address of a BindingHolder or of a PropertyHandle to its index in `nodes`
+    ids: HashMap<usize, usize>,
+    evaluations: Vec<Evaluation>,
+    /// The bindings being evaluated, with the time spent in the bindings they evaluated
+    stack: Vec<(usize, Duration)>,
+}
+
+impl Profiler {
+    fn node_for_binding(&mut self, binding: &BindingHolder) -> usize {
+        let nodes = &mut self.nodes;
+        *self.ids.entry(binding as *const BindingHolder as usize).or_insert_with(|| {
+            let name = if binding.profiler_location.is_empty() {
+                format!("binding {:p}", binding)
+            } else {
+                binding.profiler_location.clone()
+            };
+            nodes.push(Node::new(name));
+            nodes.len() - 1
+        })
+    }
+
+    fn node_for_property(&mut self, property: &PropertyHandle) -> usize {
+        if property.handle.get() & 0b10 != 0 {
+            let binding = (property.handle.get() & !0b11) as *const BindingHolder;
+            return self.node_for_binding(unsafe { &*binding });
+        }
+        let nodes = &mut self.nodes;
+        *self.ids.entry(property as *const PropertyHandle as usize).or_insert_with(|| {
+            nodes.push(Node::new(format!("property {:p}", property)));
+            nodes.len() - 1
+        })
+    }
+
+    fn elapsed(&self) -> Duration {
+        self.recorded_time + self.start.map_or(Duration::ZERO, |start| start.elapsed())
+    }
+}
+
+impl Node {
+    fn new(name: String) -> Self {
+        Self {
+            name,
+            evaluations: 0,
+            total_time: Duration::ZERO,
+            self_time: Duration::ZERO,
+            max_time: Duration::ZERO,
+            dependencies: Default::default(),
+        }
+    }
+}
+
+thread_local!(static PROFILER: RefCell<Profiler> = Default::default());
+
+fn with_recording_profiler<R>(f: impl FnOnce(&mut Profiler) -> R) -> Option<R> {
+    PROFILER.with(|p| {
+        let mut p = p.borrow_mut();
+        p.start.is_some().then(|| f(&mut p))
+    })
+}
+
+/// Starts recording the evaluations of bindings on the current thread, in addition to what was
+/// recorded since the last call to [`reset`].
+pub fn start() {
+    PROFILER.with(|p| {
+        let mut p = p.borrow_mut();
+        if p.start.is_none() {
+            p.start = Some(instant::Instant::now());
+        }
+    })
+}
+
+/// Stops recording, keeping what was recorded so far.
+pub fn stop() {
+    PROFILER.with(|p| {
+        let mut p = p.borrow_mut();
+        if let Some(start) = p.start.take() {
+            p.recorded_time += start.elapsed();
+        }
+    })
+}
+
+/// Discards everything that was recorded.
+pub fn reset() {
+    PROFILER.with(|p| {
+        let mut p = p.borrow_mut();
+        let recording = p.start.is_some();
+        *p = Profiler::default();
+        if recording {
+            p.start = Some(instant::Instant::now());
+        }
+    })
+}
+
+/// Called by PropertyHandle::update around the evaluation of a binding
+pub(super) fn record_evaluation<R>(binding: &BindingHolder, evaluate: impl FnOnce() -> R) -> R {
+    let start = with_recording_profiler(|p| {
+        let node = p.node_for_binding(binding);
+        p.stack.push((node, Duration::ZERO));
+        p.elapsed()
+    });
+    let result = evaluate();
+    if let Some(start) = start {
+        PROFILER.with(|p| {
+            let p = &mut *p.borrow_mut();
+            // The stack was cleared if the profiler was reset during the evaluation
+            if let Some((node, children_time)) = p.stack.pop() {
+                let duration = p.elapsed().saturating_sub(start);
+                if let Some(parent) = p.stack.last_mut() {
+                    parent.1 += duration;
+                }
+                let n = &mut p.nodes[node];
+                n.evaluations += 1;
+                n.total_time += duration;
+                n.self_time += duration.saturating_sub(children_time);
+                n.max_time = n.max_time.max(duration);
+                p.evaluations.push(Evaluation { node, start, duration });
+            }
+        });
+    }
+    result
+}
+
+/// Called when `binding` registers itself as a dependency of `property`
+pub(super) fn record_dependency(binding: &BindingHolder, property: &PropertyHandle) {
+    with_recording_profiler(|p| {
+        if let Some(&node) = p.ids.get(&(binding as *const BindingHolder as usize)) {
+            let dependency = p.node_for_property(property);
+            p.nodes[node].dependencies.insert(dependency);
+        }
+    });
+}
+
+/// Called when a binding is destroyed, so that a new binding allocated at the same address
+/// is recorded separately.
+pub(super) fn forget_binding(binding: *const BindingHolder) {
+    PROFILER.with(|p| {
+        if let Ok(mut p) = p.try_borrow_mut() {
+            p.ids.remove(&(binding as usize));
+        }
+    })
+}
+
+fn write_json_string(out: &mut String, s: &str) {
+    out.push('"');
+    for c in s.chars() {
+        match c {
+            '"' => out.push_str("\\\""),
+            '\\' => out.push_str("\\\\"),
+            c if (c as u32) < 0x20 => write!(out, "\\u{:04x}", c as u32).unwrap(),
+            c => out.push(c),
+        }
+    }
+    out.push('"');
+}
+
+/// Returns the recorded evaluations in the Chrome trace event format, which can be loaded in
+/// `chrome://tracing` or in the Perfetto UI. Each evaluation is a complete event named after
+/// the binding, and lists the properties that the binding depends on in its arguments.
+pub fn chrome_trace() -> String {
+    PROFILER.with(|p| {
+        let p = p.borrow();
+        let mut out = String::from("{\"traceEvents\":[");
+        for (i, evaluation) in p.evaluations.iter().enumerate() {
+            let node = &p.nodes[evaluation.node];
+            if i > 0 {
+                out.push(',');
+            }
+            out.push_str("\n{\"name\":");
+            write_json_string(&mut out, &node.name);
+            write!(
+                out,
+                ",\"cat\":\"binding\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":{:.3},\"dur\":{:.3}",
+                evaluation.start.as_secs_f64() * 1_000_000.,
+                evaluation.duration.as_secs_f64() * 1_000_000.,
+            )
+            .unwrap();
+            out.push_str(",\"args\":{\"dependencies\":[");
+            for (i, dependency) in node.dependencies.iter().enumerate() {
+                if i > 0 {
+                    out.push(',');
+                }
+                write_json_string(&mut out, &p.nodes[*dependency].name);
+            }
+            out.push_str("]}}");
+        }
+        out.push_str("\n],\"displayTimeUnit\":\"ms\"}\n");
+        out
+    })
+}
+
+/// Returns a table of the `max_rows` bindings that took the most time to evaluate, excluding
+/// the time spent evaluating the bindings they depend on, with the number of evaluations per
+/// second of recording and their dependencies.
+pub fn summary(max_rows: usize) -> String {
+    PROFILER.with(|p| {
+        let p = p.borrow();
+        let mut nodes: Vec<&Node> = p.nodes.iter().filter(|n| n.evaluations > 0).collect();
+        nodes.sort_by(|a, b| b.self_time.cmp(&a.self_time));
+        let seconds = p.elapsed().as_secs_f64();
+        let mut out = format!(
+            "{:>12} {:>12} {:>12} {:>12} {:>12}  binding\n",
+            "evaluations", "per second", "self (ms)", "total (ms)", "max (ms)"
+        );
+        for node in nodes.into_iter().take(max_rows) {
+            write!(
+                out,
+                "{:>12} {:>12.1} {:>12.3} {:>12.3} {:>12.3}  {}",
+                node.evaluations,
+                if seconds > 0. { node.evaluations as f64 / seconds } else { 0. },
+                node.self_time.as_secs_f64() * 1000.,
+                node.total_time.as_secs_f64() * 1000.,
+                node.max_time.as_secs_f64() * 1000.,
+                node.name
+            )
+            .unwrap();
+            if !node.dependencies.is_empty() {
+                out.push_str(" (depends on ");
+                for (i, dependency) in node.dependencies.iter().enumerate() {
+                    if i > 0 {
+                        out.push_str(", ");
+                    }
+                    out.push_str(&p.nodes[*dependency].name);
+                }
+                out.push(')');
+            }
+            out.push('\n');
+        }
+        out
+    })
+}
+
+#[test]
+fn profile_bindings() {
+    use super::Property;
+    use std::rc::Rc;
+
+    reset();
+    let base = Rc::pin(Property::new(1));
+    let doubled = Rc::pin(Property::new(0));
+    {
+        let base = base.clone();
+        doubled.set_binding(move || base.as_ref().get() * 2);
+    }
+    doubled.handle.set_profiler_location("test.slint:2".into());
+
+    doubled.as_ref().get();
+    start();
+    for i in 0..3 {
+        base.set(i);
+        doubled.as_ref().get();
+    }
+    stop();
+    base.set(10);
+    doubled.as_ref().get();
+
+    let summary = summary(10);
+    assert_eq!(summary.lines().count(), 2);
+    let row = summary.lines().nth(1).unwrap();
+    assert!(row.trim_start().starts_with("3 "), "{}", row);
+    assert!(row.contains("test.slint:2 (depends on property 0x"), "{}", row);
+
+    let trace = chrome_trace();
+    assert_eq!(trace.matches("\"name\":\"test.slint:2\"").count(), 3);
+    reset();
+    assert_eq!(summary(10).lines().count(), 1);
+}
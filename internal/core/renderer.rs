@@ -70,6 +70,22 @@ fn register_font_from_path(
         Err("This renderer does not support registering custom fonts.".into())
     }
 
+    /// Prepares the rendering of the `characters` with the font of `font_request` at each of the
+    /// `pixel_sizes`: loading the fonts and the fallback fonts they need, shaping them and
+    /// rasterizing their glyphs where the renderer caches them, so that the first frame showing
+    /// them doesn't have to. The `pixel_size` of the request is ignored.
+    ///
+    /// The default implementation does nothing, for the renderers that don't rasterize glyphs at
+    /// run-time.
+    fn prewarm_glyph_cache(
+        &self,
+        _font_request: crate::graphics::FontRequest,
+        _pixel_sizes: &[LogicalLength],
+        _characters: &str,
+        _scale_factor: ScaleFactor,
+    ) {
+    }
+
     fn register_bitmap_font(&self, _font_data: &'static crate::graphics::BitmapFont) {
         crate::debug_log!("Internal error: The current renderer cannot load fonts build with the `EmbedForSoftwareRenderer` option. Please use the software Renderer, or disable that option when building your slint files");
     }
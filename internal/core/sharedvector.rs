@@ -32,21 +32,117 @@ fn compute_inner_layout<T>(capacity: usize) -> core::alloc::Layout {
         .0
 }
 
+/// The functions used to allocate and free the memory of every SharedVector and SharedString,
+/// installed with [`set_allocator`].
+///
+/// They can be called from any thread, and `user_data` is passed to them.
+#[repr(C)]
+pub struct SharedVectorAllocator {
+    /// Passed to the functions
+    pub user_data: *mut core::ffi::c_void,
+    /// Returns a block of `size` bytes aligned to `align`, or null if there is no memory left
+    pub allocate: unsafe extern "C" fn(
+        user_data: *mut core::ffi::c_void,
+        size: usize,
+        align: usize,
+    ) -> *mut u8,
+    /// Frees a block returned by `allocate` for the same `size` and `align`
+    pub free: unsafe extern "C" fn(
+        user_data: *mut core::ffi::c_void,
+        ptr: *mut u8,
+        size: usize,
+        align: usize,
+    ),
+}
+
+// Safety: the functions must be thread-safe, as documented
+unsafe impl Sync for SharedVectorAllocator {}
+
+unsafe extern "C" fn default_allocate(
+    _: *mut core::ffi::c_void,
+    size: usize,
+    align: usize,
+) -> *mut u8 {
+    ::alloc::alloc::alloc(core::alloc::Layout::from_size_align_unchecked(size, align))
+}
+
+unsafe extern "C" fn default_free(
+    _: *mut core::ffi::c_void,
+    ptr: *mut u8,
+    size: usize,
+    align: usize,
+) {
+    ::alloc::alloc::dealloc(ptr, core::alloc::Layout::from_size_align_unchecked(size, align))
+}
+
+static DEFAULT_ALLOCATOR: SharedVectorAllocator = SharedVectorAllocator {
+    user_data: core::ptr::null_mut(),
+    allocate: default_allocate,
+    free: default_free,
+};
+
+/// Null until set_allocator is called or until the first allocation, which freezes the default
+static ALLOCATOR: atomic::AtomicPtr<SharedVectorAllocator> =
+    atomic::AtomicPtr::new(core::ptr::null_mut());
+
+fn allocator() -> &'static SharedVectorAllocator {
+    let current = ALLOCATOR.load(atomic::Ordering::Acquire);
+    if !current.is_null() {
+        return unsafe { &*current };
+    }
+    let default = &DEFAULT_ALLOCATOR as *const _ as *mut _;
+    match ALLOCATOR.compare_exchange(
+        core::ptr::null_mut(),
+        default,
+        atomic::Ordering::AcqRel,
+        atomic::Ordering::Acquire,
+    ) {
+        Ok(_) => &DEFAULT_ALLOCATOR,
+        Err(current) => unsafe { &*current },
+    }
+}
+
+/// Installs the allocator used for the memory of every SharedVector and SharedString, for
+/// example a pool of size classes that bounds the fragmentation of the heap on embedded
+/// targets. The blocks can outlive a frame, so an arena must be able to free them individually.
+///
+/// This must be called before the first SharedVector or SharedString is allocated, so that
+/// every block is freed by the allocator that allocated it. Returns false, and doesn't change
+/// anything, if an allocator was already installed or if a block was already allocated.
+pub fn set_allocator(allocator: &'static SharedVectorAllocator) -> bool {
+    ALLOCATOR
+        .compare_exchange(
+            core::ptr::null_mut(),
+            allocator as *const _ as *mut _,
+            atomic::Ordering::AcqRel,
+            atomic::Ordering::Acquire,
+        )
+        .is_ok()
+}
+
+fn allocate(layout: core::alloc::Layout) -> *mut u8 {
+    let allocator = allocator();
+    unsafe { (allocator.allocate)(allocator.user_data, layout.size(), layout.align()) }
+}
+
+/// Safety: ptr must have been returned by allocate() for the same layout
+unsafe fn free(ptr: *mut u8, layout: core::alloc::Layout) {
+    let allocator = allocator();
+    (allocator.free)(allocator.user_data, ptr, layout.size(), layout.align())
+}
+
 unsafe fn drop_inner<T>(mut inner: NonNull<SharedVectorInner<T>>) {
     debug_assert_eq!(inner.as_ref().header.refcount.load(atomic::Ordering::Relaxed), 0);
     let data_ptr = inner.as_mut().data.as_mut_ptr();
     for x in 0..inner.as_ref().header.size {
         core::ptr::drop_in_place(data_ptr.add(x));
     }
-    alloc::alloc::dealloc(
-        inner.as_ptr() as *mut u8,
-        compute_inner_layout::<T>(inner.as_ref().header.capacity),
-    )
+    free(inner.as_ptr() as *mut u8, compute_inner_layout::<T>(inner.as_ref().header.capacity))
 }
 
 /// Allocate the memory for the SharedVector with the given capacity. Return the inner with size and refcount set to 1
 fn alloc_with_capacity<T>(capacity: usize) -> NonNull<SharedVectorInner<T>> {
-    let ptr = unsafe { ::alloc::alloc::alloc(compute_inner_layout::<T>(capacity)) };
+    let ptr = allocate(compute_inner_layout::<T>(capacity));
     assert!(!ptr.is_null(), "allocation of {:?} bytes failed", capacity);
     unsafe {
         core::ptr::write(
@@ -450,7 +546,7 @@ fn drop(&mut self) {
                 for x in (*begin)..inner.as_ref().header.size {
                     core::ptr::drop_in_place(data_ptr.add(x));
                 }
-                ::alloc::alloc::dealloc(
+                free(
                     inner.as_ptr() as *mut u8,
                     compute_inner_layout::<T>(inner.as_ref().header.capacity),
                 )
@@ -597,13 +693,13 @@ pub(crate) mod ffi {
     #[no_mangle]
     /// This function is used for the low-level C++ interface to allocate the backing vector of a SharedVector.
     pub unsafe extern "C" fn slint_shared_vector_allocate(size: usize, align: usize) -> *mut u8 {
-        alloc::alloc::alloc(alloc::alloc::Layout::from_size_align(size, align).unwrap())
+        allocate(alloc::alloc::Layout::from_size_align(size, align).unwrap())
     }
 
     #[no_mangle]
     /// This function is used for the low-level C++ interface to deallocate the backing vector of a SharedVector
     pub unsafe extern "C" fn slint_shared_vector_free(ptr: *mut u8, size: usize, align: usize) {
-        alloc::alloc::dealloc(ptr, alloc::alloc::Layout::from_size_align(size, align).unwrap())
+        free(ptr, alloc::alloc::Layout::from_size_align(size, align).unwrap())
     }
 
     #[no_mangle]
@@ -611,4 +707,12 @@ pub(crate) mod ffi {
     pub unsafe extern "C" fn slint_shared_vector_empty() -> *const u8 {
         &SHARED_NULL as *const _ as *const u8
     }
+
+    #[no_mangle]
+    /// Installs the allocator of every SharedVector and SharedString, see [`set_allocator`]
+    pub extern "C" fn slint_shared_vector_set_allocator(
+        allocator: &'static SharedVectorAllocator,
+    ) -> bool {
+        set_allocator(allocator)
+    }
 }
@@ -143,8 +143,9 @@ fn apply_dirty_region(
     /// which are dirty. The `extra_draw_region` is an extra regin which will also
     /// be rendered. (eg: the previous dirty region in case of double buffering)
     ///
-    /// returns the dirty region for this frame (not including the extra_draw_region)
-    pub fn render(&self, buffer: &mut [impl TargetPixel], buffer_stride: usize) {
+    /// Returns the region of the buffer that was redrawn, in physical pixels. Only this region
+    /// needs to be sent to the screen.
+    pub fn render(&self, buffer: &mut [impl TargetPixel], buffer_stride: usize) -> IntRect {
         let window = self.window.upgrade().expect("render() called on a destroyed Window");
         let window_inner = WindowInner::from_pub(window.window());
         let factor = ScaleFactor::new(window_inner.scale_factor());
@@ -175,6 +176,7 @@ pub fn render(&self, buffer: &mut [impl TargetPixel], buffer_stride: usize) {
             buffer_renderer,
         );
 
+        let mut rendered_region = IntRect::default();
         window_inner.draw_contents(|components| {
             for (component, origin) in components {
                 renderer.compute_dirty_regions(component, *origin);
@@ -183,6 +185,11 @@ pub fn render(&self, buffer: &mut [impl TargetPixel], buffer_stride: usize) {
             let dirty_region = (renderer.dirty_region.to_rect().cast() * factor).round_out().cast();
 
             let to_draw = self.apply_dirty_region(dirty_region, size);
+            rendered_region = to_draw.to_untyped().cast();
+            #[cfg(feature = "std")]
+            crate::graphics::frame_statistics::record_dirty_region_area(
+                to_draw.width() as u64 * to_draw.height() as u64,
+            );
 
             renderer.combine_clip(
                 (to_draw.cast() / factor).cast(),
@@ -198,6 +205,7 @@ pub fn render(&self, buffer: &mut [impl TargetPixel], buffer_stride: usize) {
                 crate::item_rendering::render_component_items(component, &mut renderer, *origin);
             }
         });
+        rendered_region
     }
 
     /// Render the window, line by line, into the line buffer provided by the `line_callback` function.
@@ -669,6 +677,10 @@ fn prepare_scene<const MAX_BUFFER_AGE: usize>(
 
         dirty_region = (renderer.dirty_region.to_rect().cast() * factor).round_out().cast();
         dirty_region = software_renderer.apply_dirty_region(dirty_region, size);
+        #[cfg(feature = "std")]
+        crate::graphics::frame_statistics::record_dirty_region_area(
+            dirty_region.width() as u64 * dirty_region.height() as u64,
+        );
 
         renderer.combine_clip(
             (dirty_region.cast() / factor).cast(),
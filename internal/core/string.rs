@@ -96,6 +96,19 @@ pub fn push_str(&mut self, x: &str) {
             self.inner.make_mut_slice()[prev_len] = first;
         }
     }
+
+    /// Removes the content of the string. If the data is not shared with another string, its
+    /// capacity is kept, so that appending to the string doesn't allocate.
+    ///
+    /// ```
+    /// # use i_slint_core::SharedString;
+    /// let mut s = SharedString::from("Hello");
+    /// s.clear();
+    /// assert_eq!(s, "");
+    /// ```
+    pub fn clear(&mut self) {
+        self.inner.clear();
+    }
 }
 
 impl Deref for SharedString {
@@ -107,6 +120,10 @@ fn deref(&self) -> &Self::Target {
 
 impl From<&str> for SharedString {
     fn from(value: &str) -> Self {
+        if value.is_empty() {
+            // The empty string doesn't allocate
+            return Self::default();
+        }
         SharedString {
             inner: SharedVector::from_iter(
                 value.as_bytes().iter().cloned().chain(core::iter::once(0)),
@@ -154,6 +171,12 @@ fn as_ref(&self) -> &[u8] {
     }
 }
 
+impl core::borrow::Borrow<str> for SharedString {
+    fn borrow(&self) -> &str {
+        self.as_str()
+    }
+}
+
 impl<T> PartialEq<T> for SharedString
 where
     T: ?Sized + AsRef<str>,
@@ -229,6 +252,54 @@ fn write_str(&mut self, s: &str) -> core::fmt::Result {
     }
 }
 
+/// A set of strings that lets recurring strings share their data.
+///
+/// [`intern`](StringInterner::intern) returns a copy of the string that was interned before
+/// with the same content, which only increments its reference count, and only allocates the
+/// first time a string is interned.
+///
+/// ```
+/// # use i_slint_core::string::StringInterner;
+/// let mut interner = StringInterner::default();
+/// let a = interner.intern("OK");
+/// let b = interner.intern("OK");
+/// assert_eq!(a.as_ptr(), b.as_ptr());
+/// ```
+#[cfg(feature = "std")]
+#[derive(Default)]
+pub struct StringInterner {
+    strings: std::collections::HashSet<SharedString>,
+}
+
+#[cfg(feature = "std")]
+impl StringInterner {
+    /// Returns a string equal to `s`, sharing its data with the previously interned one if any
+    pub fn intern(&mut self, s: &str) -> SharedString {
+        if let Some(interned) = self.strings.get(s) {
+            return interned.clone();
+        }
+        let interned = SharedString::from(s);
+        self.strings.insert(interned.clone());
+        interned
+    }
+
+    /// The number of distinct strings in this interner
+    pub fn len(&self) -> usize {
+        self.strings.len()
+    }
+
+    /// Returns true if no string was interned
+    pub fn is_empty(&self) -> bool {
+        self.strings.is_empty()
+    }
+
+    /// Forgets the interned strings. The strings returned by
+    /// [`intern`](StringInterner::intern) stay valid.
+    pub fn clear(&mut self) {
+        self.strings.clear()
+    }
+}
+
 /// Same as [`std::fmt::format()`], but return a [`SharedString`] instead
 pub fn format(args: core::fmt::Arguments<'_>) -> SharedString {
     // unfortunately, the estimated_capacity is unstable
@@ -376,6 +447,83 @@ fn test_slint_shared_string_from_number() {
         let str = core::str::from_utf8(core::slice::from_raw_parts(bytes, len)).unwrap();
         self_.push_str(str);
     }
+    /// Remove the content of the string, but keep its capacity if it is not shared
+    #[no_mangle]
+    pub extern "C" fn slint_shared_string_clear(self_: &mut SharedString) {
+        self_.clear()
+    }
+
+    /// Append a number formatted like slint_shared_string_from_number, or with `decimals`
+    /// digits after the decimal point if it isn't negative
+    #[no_mangle]
+    pub extern "C" fn slint_shared_string_append_number(
+        self_: &mut SharedString,
+        n: f64,
+        decimals: i32,
+    ) {
+        if decimals < 0 {
+            write!(self_, "{}", n).unwrap();
+        } else {
+            write!(self_, "{:.*}", decimals as usize, n).unwrap();
+        }
+    }
+
+    #[test]
+    fn test_slint_shared_string_append_number() {
+        let mut s = SharedString::from("x = ");
+        slint_shared_string_append_number(&mut s, 12.5, -1);
+        s.push_str(", y = ");
+        slint_shared_string_append_number(&mut s, 2., 2);
+        assert_eq!(s.as_str(), "x = 12.5, y = 2.00");
+        let capacity = s.inner.capacity();
+        slint_shared_string_clear(&mut s);
+        assert_eq!(s.as_str(), "");
+        slint_shared_string_append_number(&mut s, 42., -1);
+        assert_eq!(s.as_str(), "42");
+        assert_eq!(s.inner.capacity(), capacity);
+    }
+
+    /// Create a new StringInterner, to be destroyed with slint_string_interner_drop
+    #[cfg(feature = "std")]
+    #[no_mangle]
+    pub extern "C" fn slint_string_interner_new() -> *mut StringInterner {
+        Box::into_raw(Box::new(StringInterner::default()))
+    }
+
+    /// Destroy a StringInterner created with slint_string_interner_new
+    #[cfg(feature = "std")]
+    #[no_mangle]
+    pub unsafe extern "C" fn slint_string_interner_drop(interner: *mut StringInterner) {
+        drop(Box::from_raw(interner))
+    }
+
+    /// Set `out` to the interned string equal to the utf-8 `bytes` of size `len`
+    #[cfg(feature = "std")]
+    #[no_mangle]
+    pub unsafe extern "C" fn slint_string_interner_intern(
+        interner: &mut StringInterner,
+        bytes: *const c_char,
+        len: usize,
+        out: &mut SharedString,
+    ) {
+        let str = core::str::from_utf8(core::slice::from_raw_parts(bytes, len)).unwrap();
+        *out = interner.intern(str);
+    }
+
+    /// Forget the strings of the interner
+    #[cfg(feature = "std")]
+    #[no_mangle]
+    pub extern "C" fn slint_string_interner_clear(interner: &mut StringInterner) {
+        interner.clear()
+    }
+
+    /// The number of strings in the interner
+    #[cfg(feature = "std")]
+    #[no_mangle]
+    pub extern "C" fn slint_string_interner_len(interner: &StringInterner) -> usize {
+        interner.len()
+    }
+
     #[test]
     fn test_slint_shared_string_append() {
         let mut s = SharedString::default();
@@ -208,8 +208,16 @@ pub struct WindowInner {
     /// This is a cache of the size set by the set_inner_size setter.
     /// It should be mapping with the WindowItem::width and height (only in physical)
     pub(crate) inner_size: Cell<PhysicalSize>,
+    #[cfg(feature = "std")]
+    frame_statistics: RefCell<crate::graphics::frame_statistics::FrameStatisticsRecorder>,
+    /// The callbacks registered with [`Self::request_animation_frame()`], with their id
+    animation_frame_callbacks: RefCell<alloc::vec::Vec<(u64, AnimationFrameCallback)>>,
+    next_animation_frame_id: Cell<u64>,
 }
 
+/// A callback run before the next frame of a window, with the animation tick of that frame
+pub type AnimationFrameCallback = Box<dyn FnOnce(crate::animations::Instant)>;
+
 impl Drop for WindowInner {
     fn drop(&mut self) {
         if let Some(existing_blinker) = self.cursor_blinker.borrow().upgrade() {
@@ -252,6 +260,10 @@ pub fn new(window_adapter_weak: Weak<dyn WindowAdapter>) -> Self {
             active_popup: Default::default(),
             close_requested: Default::default(),
             inner_size: Default::default(),
+            #[cfg(feature = "std")]
+            frame_statistics: Default::default(),
+            animation_frame_callbacks: Default::default(),
+            next_animation_frame_id: Cell::new(1),
         };
 
         window
@@ -536,6 +548,8 @@ pub fn update_window_properties(&self) {
     /// Calls the render_components to render the main component and any sub-window components, tracked by a
     /// property dependency tracker.
     pub fn draw_contents(&self, render_components: impl FnOnce(&[(&ComponentRc, LogicalPoint)])) {
+        self.run_animation_frame_callbacks();
+
         let draw_fn = || {
             let component_rc = self.component();
 
@@ -557,9 +571,101 @@ pub fn draw_contents(&self, render_components: impl FnOnce(&[(&ComponentRc, Logi
             }
         };
 
+        #[cfg(feature = "std")]
+        if self.frame_statistics.borrow().is_enabled() {
+            let size = self.inner_size.get();
+            let frame = crate::graphics::frame_statistics::collect_frame(
+                size.width as u64 * size.height as u64,
+                || self.redraw_tracker.as_ref().evaluate_as_dependency_root(draw_fn),
+            );
+            self.frame_statistics.borrow_mut().record(frame);
+            // Call the callback without borrowing, so that it can use the window
+            let callback = self.frame_statistics.borrow_mut().callback.take();
+            if let Some(mut callback) = callback {
+                callback(&frame);
+                self.frame_statistics.borrow_mut().callback.get_or_insert(callback);
+            }
+            return;
+        }
+
         self.redraw_tracker.as_ref().evaluate_as_dependency_root(draw_fn)
     }
 
+    /// Keeps the statistics of the last `size` rendered frames, to be returned by
+    /// [`Self::frame_statistics_history()`]. A size of 0 clears the history and stops recording,
+    /// unless a callback is set with [`Self::set_frame_statistics_callback()`].
+    #[cfg(feature = "std")]
+    pub fn set_frame_statistics_history_size(&self, size: usize) {
+        let mut recorder = self.frame_statistics.borrow_mut();
+        recorder.history_size = size;
+        let excess = recorder.history.len().saturating_sub(size);
+        recorder.history.drain(..excess);
+    }
+
+    /// Returns the statistics of the last rendered frames, from the oldest to the most recent.
+    #[cfg(feature = "std")]
+    pub fn frame_statistics_history(
+        &self,
+    ) -> impl Iterator<Item = crate::graphics::frame_statistics::FrameStatistics> {
+        self.frame_statistics.borrow().history.clone().into_iter()
+    }
+
+    /// Sets a callback that is invoked with the statistics of each frame after it was rendered.
+    #[cfg(feature = "std")]
+    pub fn set_frame_statistics_callback(
+        &self,
+        callback: Option<Box<dyn FnMut(&crate::graphics::frame_statistics::FrameStatistics)>>,
+    ) {
+        self.frame_statistics.borrow_mut().callback = callback;
+    }
+
+    /// Registers a callback that is run once, right before the next frame of this window is
+    /// rendered, with the animation tick of that frame. The properties that the callback sets are
+    /// shown in that same frame.
+    ///
+    /// To run a callback on every frame, register it again from the callback: a callback only
+    /// requests one frame, so the window stops redrawing as soon as no callback is registered
+    /// and nothing else changed. Returns an id for [`Self::cancel_animation_frame()`].
+    pub fn request_animation_frame(&self, callback: AnimationFrameCallback) -> u64 {
+        let id = self.next_animation_frame_id.get();
+        self.next_animation_frame_id.set(id + 1);
+        self.animation_frame_callbacks.borrow_mut().push((id, callback));
+        if let Some(window_adapter) = self.window_adapter_weak.upgrade() {
+            window_adapter.request_redraw();
+        }
+        id
+    }
+
+    /// Unregisters a callback registered with [`Self::request_animation_frame()`]. Does nothing
+    /// if it already ran or was cancelled.
+    pub fn cancel_animation_frame(&self, id: u64) {
+        self.animation_frame_callbacks.borrow_mut().retain(|(callback_id, _)| *callback_id != id);
+    }
+
+    fn run_animation_frame_callbacks(&self) {
+        if self.animation_frame_callbacks.borrow().is_empty() {
+            return;
+        }
+        let tick = crate::animations::current_tick();
+        // The properties set by the callbacks are rendered in this frame, they must not request
+        // another one
+        self.redraw_tracker.set_dirty();
+        // The callbacks registered while running them are for the next frame, and the ones
+        // cancelled by a previous callback don't run. They are removed one at a time so that
+        // they can use the window.
+        let last_id = self.next_animation_frame_id.get() - 1;
+        loop {
+            let callback = {
+                let mut callbacks = self.animation_frame_callbacks.borrow_mut();
+                match callbacks.first() {
+                    Some((id, _)) if *id <= last_id => callbacks.remove(0).1,
+                    _ => break,
+                }
+            };
+            callback(tick);
+        }
+    }
+
     /// Registers the window with the windowing system, in order to render the component's items and react
     /// to input events once the event loop spins.
     pub fn show(&self) {
@@ -935,6 +1041,110 @@ fn call(&self) -> CloseRequestResponse {
         window_adapter.window().on_close_requested(move || with_user_data.call());
     }
 
+    /// Keeps the statistics of the last `size` frames rendered in the window.
+    #[cfg(feature = "std")]
+    #[no_mangle]
+    pub unsafe extern "C" fn slint_windowrc_set_frame_statistics_history_size(
+        handle: *const WindowAdapterRcOpaque,
+        size: usize,
+    ) {
+        let window_adapter = &*(handle as *const Rc<dyn WindowAdapter>);
+        WindowInner::from_pub(window_adapter.window()).set_frame_statistics_history_size(size);
+    }
+
+    /// Returns the statistics of the last frames rendered in the window.
+    #[cfg(feature = "std")]
+    #[no_mangle]
+    pub unsafe extern "C" fn slint_windowrc_frame_statistics_history(
+        handle: *const WindowAdapterRcOpaque,
+        out: &mut crate::SharedVector<crate::graphics::frame_statistics::FrameStatistics>,
+    ) {
+        let window_adapter = &*(handle as *const Rc<dyn WindowAdapter>);
+        *out = WindowInner::from_pub(window_adapter.window()).frame_statistics_history().collect();
+    }
+
+    /// Sets the callback invoked with the statistics of each frame rendered in the window.
+    #[cfg(feature = "std")]
+    #[no_mangle]
+    pub unsafe extern "C" fn slint_windowrc_set_frame_statistics_callback(
+        handle: *const WindowAdapterRcOpaque,
+        callback: extern "C" fn(
+            statistics: &crate::graphics::frame_statistics::FrameStatistics,
+            user_data: *mut c_void,
+        ),
+        drop_user_data: extern "C" fn(user_data: *mut c_void),
+        user_data: *mut c_void,
+    ) {
+        struct WithUserData {
+            callback: extern "C" fn(
+                statistics: &crate::graphics::frame_statistics::FrameStatistics,
+                user_data: *mut c_void,
+            ),
+            drop_user_data: extern "C" fn(*mut c_void),
+            user_data: *mut c_void,
+        }
+
+        impl Drop for WithUserData {
+            fn drop(&mut self) {
+                (self.drop_user_data)(self.user_data)
+            }
+        }
+
+        impl WithUserData {
+            fn call(&self, statistics: &crate::graphics::frame_statistics::FrameStatistics) {
+                (self.callback)(statistics, self.user_data)
+            }
+        }
+
+        let with_user_data = WithUserData { callback, drop_user_data, user_data };
+
+        let window_adapter = &*(handle as *const Rc<dyn WindowAdapter>);
+        WindowInner::from_pub(window_adapter.window()).set_frame_statistics_callback(Some(
+            Box::new(move |statistics| with_user_data.call(statistics)),
+        ));
+    }
+
+    /// Registers a callback run once before the next frame rendered in the window, with the
+    /// animation tick of that frame in milliseconds. Returns the id to cancel it.
+    #[no_mangle]
+    pub unsafe extern "C" fn slint_windowrc_request_animation_frame(
+        handle: *const WindowAdapterRcOpaque,
+        callback: extern "C" fn(tick: u64, user_data: *mut c_void),
+        drop_user_data: Option<extern "C" fn(user_data: *mut c_void)>,
+        user_data: *mut c_void,
+    ) -> u64 {
+        struct WithUserData {
+            callback: extern "C" fn(u64, *mut c_void),
+            drop_user_data: Option<extern "C" fn(*mut c_void)>,
+            user_data: *mut c_void,
+        }
+
+        impl Drop for WithUserData {
+            fn drop(&mut self) {
+                if let Some(drop_user_data) = self.drop_user_data {
+                    drop_user_data(self.user_data)
+                }
+            }
+        }
+
+        let with_user_data = WithUserData { callback, drop_user_data, user_data };
+
+        let window_adapter = &*(handle as *const Rc<dyn WindowAdapter>);
+        WindowInner::from_pub(window_adapter.window()).request_animation_frame(Box::new(
+            move |tick| (with_user_data.callback)(tick.0, with_user_data.user_data),
+        ))
+    }
+
+    /// Unregisters a callback registered with slint_windowrc_request_animation_frame.
+    #[no_mangle]
+    pub unsafe extern "C" fn slint_windowrc_cancel_animation_frame(
+        handle: *const WindowAdapterRcOpaque,
+        id: u64,
+    ) {
+        let window_adapter = &*(handle as *const Rc<dyn WindowAdapter>);
+        WindowInner::from_pub(window_adapter.window()).cancel_animation_frame(id);
+    }
+
     /// This function issues a request to the windowing system to redraw the contents of the window.
     #[no_mangle]
     pub unsafe extern "C" fn slint_windowrc_request_redraw(handle: *const WindowAdapterRcOpaque) {
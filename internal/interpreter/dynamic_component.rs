@@ -274,6 +274,32 @@ unsafe fn get_untagged(&self) -> &RepeaterWithinComponent<'id, 'static> {
 
 type Callback = i_slint_core::Callback<[Value], Value>;
 
+/// The name of a property or callback of the root element of a component, resolved with
+/// [`ComponentDescription::resolve_name`]
+pub struct ResolvedName {
+    target: ResolvedTarget,
+    /// The type of the property or callback, as declared in the root element
+    pub property_type: Type,
+    /// The ComponentDescription this name was resolved for. It also keeps the `PropertyInfo`,
+    /// `ItemWithinComponent` and `ErasedCallbackInfo` the target points to alive.
+    description: ErasedComponentDescription,
+}
+
+/// Where the property or callback of a [`ResolvedName`] is stored in an instance.
+/// The pointers point into the ComponentDescription the name was resolved for.
+enum ResolvedTarget {
+    /// A property declared in the root element, at this offset in the instance
+    Property { offset: usize, info: *const dyn PropertyInfo<u8, Value> },
+    /// A callback declared in the root element, at this offset in the instance
+    Callback { offset: usize },
+    /// A property of a native item the root element property is an alias of
+    ItemProperty { item: *const ItemWithinComponent, info: *const dyn eval::ErasedPropertyInfo },
+    /// A callback of a native item the root element callback is an alias of
+    ItemCallback { item: *const ItemWithinComponent, info: *const dyn eval::ErasedCallbackInfo },
+    /// An animated property, or an alias to a global: these are still looked up by name
+    Named { element: ElementRc, name: String },
+}
+
 #[derive(Clone)]
 pub struct ErasedComponentDescription(Rc<ComponentDescription<'static>>);
 impl ErasedComponentDescription {
@@ -603,6 +629,187 @@ pub fn invoke_callback(
         }
     }
 
+    /// Resolve the name of a property or callback declared in the root element, so that it
+    /// can be accessed with [`Self::get_resolved_property`], [`Self::set_resolved_property`]
+    /// and [`Self::invoke_resolved_callback`] without looking up its declaration again.
+    ///
+    /// Returns None if there is no such property or callback, or if `callback` does not match
+    /// the kind of the declaration.
+    pub fn resolve_name(self: &Rc<Self>, name: &str, callback: bool) -> Option<ResolvedName> {
+        let root_element = self.original.root_element.borrow();
+        let decl = root_element.property_declarations.get(name)?;
+        if matches!(decl.property_type, Type::Callback { .. }) != callback {
+            return None;
+        }
+        let (element, name) = match decl.is_alias.as_ref() {
+            Some(alias) => (alias.element(), alias.name().to_string()),
+            None => (self.original.root_element.clone(), name.to_string()),
+        };
+        Some(ResolvedName {
+            target: self.resolve_target(element, name, callback),
+            property_type: decl.property_type.clone(),
+            description: self.clone().into(),
+        })
+    }
+
+    fn resolve_target(&self, element: ElementRc, name: String, callback: bool) -> ResolvedTarget {
+        let named = |element, name| ResolvedTarget::Named { element, name };
+        let elem = element.borrow();
+        let in_this_component =
+            elem.enclosing_component.upgrade().map_or(false, |c| Rc::ptr_eq(&c, &self.original));
+        if !in_this_component {
+            drop(elem);
+            return named(element, name);
+        }
+        if !callback
+            && elem.bindings.get(name.as_str()).map_or(false, |b| b.borrow().animation.is_some())
+        {
+            drop(elem);
+            return named(element, name);
+        }
+        if Rc::ptr_eq(&element, &self.original.root_element) {
+            if callback {
+                if let Some(offset) = self.custom_callbacks.get(name.as_str()) {
+                    return ResolvedTarget::Callback { offset: offset.get_byte_offset() };
+                }
+            } else if let Some(x) = self.custom_properties.get(name.as_str()) {
+                return ResolvedTarget::Property { offset: x.offset, info: &*x.prop };
+            }
+        }
+        let target = self.items.get(elem.id.as_str()).and_then(|item| {
+            if callback {
+                let info = item.rtti.callbacks.get(name.as_str())?;
+                Some(ResolvedTarget::ItemCallback { item, info: &**info })
+            } else {
+                let info = item.rtti.properties.get(name.as_str())?;
+                Some(ResolvedTarget::ItemProperty { item, info: &**info })
+            }
+        });
+        drop(elem);
+        target.unwrap_or_else(|| named(element, name))
+    }
+
+    /// Returns true if the `resolved` name was resolved for this description and the component
+    /// is an instance of it.
+    fn is_resolved_for(&self, component: ComponentRefPin, resolved: &ResolvedName) -> bool {
+        core::ptr::eq(
+            Rc::as_ptr(&resolved.description.0) as *const u8,
+            self as *const Self as *const u8,
+        ) && core::ptr::eq((&self.ct) as *const _, component.get_vtable() as *const _)
+    }
+
+    /// Same as [`Self::get_property`], with a name from [`Self::resolve_name`]
+    pub fn get_resolved_property(
+        &self,
+        component: ComponentRefPin,
+        resolved: &ResolvedName,
+    ) -> Result<Value, ()> {
+        if !self.is_resolved_for(component, resolved) {
+            return Err(());
+        }
+        // Safety: we just verified that the component has the right vtable, and the target
+        // points into this description
+        unsafe {
+            match &resolved.target {
+                ResolvedTarget::Property { offset, info } => {
+                    (**info).get(Pin::new_unchecked(&*component.as_ptr().add(*offset)))
+                }
+                ResolvedTarget::ItemProperty { item, info } => {
+                    Ok((**info).get((**item).item_from_component(component.as_ptr())))
+                }
+                ResolvedTarget::Named { element, name } => {
+                    generativity::make_guard!(guard);
+                    let c = InstanceRef::from_pin_ref(component, guard);
+                    eval::load_property(c, element, name)
+                }
+                ResolvedTarget::Callback { .. } | ResolvedTarget::ItemCallback { .. } => Err(()),
+            }
+        }
+    }
+
+    /// Same as [`Self::set_property`], with a name from [`Self::resolve_name`]
+    pub fn set_resolved_property(
+        &self,
+        component: ComponentRefPin,
+        resolved: &ResolvedName,
+        value: Value,
+    ) -> Result<(), crate::api::SetPropertyError> {
+        use crate::api::SetPropertyError;
+        if !self.is_resolved_for(component, resolved) {
+            return Err(SetPropertyError::NoSuchProperty);
+        }
+        // Safety: we just verified that the component has the right vtable, and the target
+        // points into this description
+        unsafe {
+            match &resolved.target {
+                ResolvedTarget::Property { offset, info } => {
+                    // PropertyInfo::set does not check the type of custom structures or arrays
+                    if !eval::check_value_type(&value, &resolved.property_type) {
+                        return Err(SetPropertyError::WrongType);
+                    }
+                    let p = Pin::new_unchecked(&*component.as_ptr().add(*offset));
+                    (**info).set(p, value, None).map_err(|()| SetPropertyError::WrongType)
+                }
+                ResolvedTarget::ItemProperty { item, info } => (**info)
+                    .set((**item).item_from_component(component.as_ptr()), value, None)
+                    .map_err(|()| SetPropertyError::WrongType),
+                ResolvedTarget::Named { element, name } => {
+                    generativity::make_guard!(guard);
+                    let c = InstanceRef::from_pin_ref(component, guard);
+                    eval::store_property(c, element, name, value)
+                }
+                ResolvedTarget::Callback { .. } | ResolvedTarget::ItemCallback { .. } => {
+                    Err(SetPropertyError::NoSuchProperty)
+                }
+            }
+        }
+    }
+
+    /// Same as [`Self::invoke_callback`], with a name from [`Self::resolve_name`]
+    pub fn invoke_resolved_callback(
+        &self,
+        component: ComponentRefPin,
+        resolved: &ResolvedName,
+        args: &[Value],
+    ) -> Result<Value, ()> {
+        if !self.is_resolved_for(component, resolved) {
+            return Err(());
+        }
+        // Safety: we just verified that the component has the right vtable, and the target
+        // points into this description
+        unsafe {
+            match &resolved.target {
+                ResolvedTarget::Callback { offset } => {
+                    let callback = &*(component.as_ptr().add(*offset) as *const Callback);
+                    let res = callback.call(args);
+                    Ok(match (&res, &resolved.property_type) {
+                        // If the callback was not set, the return value is Value::Void, but it
+                        // must be of the type returned by the callback
+                        (Value::Void, Type::Callback { return_type: Some(rt), .. }) => {
+                            eval::default_value_for_type(rt)
+                        }
+                        _ => res,
+                    })
+                }
+                ResolvedTarget::ItemCallback { item, info } => {
+                    Ok((**info).call((**item).item_from_component(component.as_ptr()), args))
+                }
+                ResolvedTarget::Named { element, name } => {
+                    generativity::make_guard!(guard);
+                    let c = InstanceRef::from_pin_ref(component, guard);
+                    eval::invoke_callback(
+                        eval::ComponentInstance::InstanceRef(c),
+                        element,
+                        name,
+                        args,
+                    )
+                    .ok_or(())
+                }
+                ResolvedTarget::Property { .. } | ResolvedTarget::ItemProperty { .. } => Err(()),
+            }
+        }
+    }
+
     // Return the global with the given name
     pub fn get_global(
         &self,
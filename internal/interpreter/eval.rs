@@ -948,7 +948,7 @@ pub fn store_property(
 }
 
 /// Return true if the Value can be used for a property of the given type
-fn check_value_type(value: &Value, ty: &Type) -> bool {
+pub(crate) fn check_value_type(value: &Value, ty: &Type) -> bool {
     match ty {
         Type::Void => true,
         Type::Invalid
@@ -1,7 +1,8 @@
 // Copyright © SixtyFPS GmbH <info@slint-ui.com>
 // SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-Slint-commercial
 
-use crate::dynamic_component::ErasedComponentBox;
+use crate::dynamic_component::{ErasedComponentBox, ResolvedName};
+use crate::value_model::{NumberArrayElement, NumberArrayModel};
 
 use super::*;
 use core::ptr::NonNull;
@@ -87,6 +88,36 @@ pub extern "C" fn slint_interpreter_value_eq(a: &ValueOpaque, b: &ValueOpaque) -
     )
 }
 
+/// Construct a new Value in the given memory location as a model of the numbers of the array,
+/// which shares its buffer
+#[no_mangle]
+pub unsafe extern "C" fn slint_interpreter_value_new_number_array_f64(
+    a: &SharedVector<f64>,
+    val: *mut ValueOpaque,
+) {
+    std::ptr::write(val as *mut Value, Value::Model(ModelRc::new(NumberArrayModel::new(a.clone()))))
+}
+
+/// Construct a new Value in the given memory location as a model of the numbers of the array,
+/// which shares its buffer
+#[no_mangle]
+pub unsafe extern "C" fn slint_interpreter_value_new_number_array_f32(
+    a: &SharedVector<f32>,
+    val: *mut ValueOpaque,
+) {
+    std::ptr::write(val as *mut Value, Value::Model(ModelRc::new(NumberArrayModel::new(a.clone()))))
+}
+
+/// Construct a new Value in the given memory location as a model of the numbers of the array,
+/// which shares its buffer
+#[no_mangle]
+pub unsafe extern "C" fn slint_interpreter_value_new_number_array_i32(
+    a: &SharedVector<i32>,
+    val: *mut ValueOpaque,
+) {
+    std::ptr::write(val as *mut Value, Value::Model(ModelRc::new(NumberArrayModel::new(a.clone()))))
+}
+
 /// Construct a new Value in the given memory location as Brush
 #[no_mangle]
 pub unsafe extern "C" fn slint_interpreter_value_new_brush(brush: &Brush, val: *mut ValueOpaque) {
@@ -183,6 +214,52 @@ pub extern "C" fn slint_interpreter_value_to_array(
     }
 }
 
+fn value_to_number_array<T: NumberArrayElement>(
+    val: &ValueOpaque,
+    out: &mut SharedVector<T>,
+) -> bool {
+    match val.as_value() {
+        Value::Model(m) => match crate::value_model::to_number_array(m) {
+            Some(array) => {
+                *out = array;
+                true
+            }
+            None => false,
+        },
+        _ => false,
+    }
+}
+
+/// Sets `out` to the numbers of the model if the value is a model of numbers, sharing the buffer
+/// of a model created with slint_interpreter_value_new_number_array_f64
+#[no_mangle]
+pub extern "C" fn slint_interpreter_value_to_number_array_f64(
+    val: &ValueOpaque,
+    out: &mut SharedVector<f64>,
+) -> bool {
+    value_to_number_array(val, out)
+}
+
+/// Sets `out` to the numbers of the model if the value is a model of numbers, sharing the buffer
+/// of a model created with slint_interpreter_value_new_number_array_f32
+#[no_mangle]
+pub extern "C" fn slint_interpreter_value_to_number_array_f32(
+    val: &ValueOpaque,
+    out: &mut SharedVector<f32>,
+) -> bool {
+    value_to_number_array(val, out)
+}
+
+/// Sets `out` to the numbers of the model if the value is a model of numbers, sharing the buffer
+/// of a model created with slint_interpreter_value_new_number_array_i32
+#[no_mangle]
+pub extern "C" fn slint_interpreter_value_to_number_array_i32(
+    val: &ValueOpaque,
+    out: &mut SharedVector<i32>,
+) -> bool {
+    value_to_number_array(val, out)
+}
+
 #[no_mangle]
 pub extern "C" fn slint_interpreter_value_to_brush(val: &ValueOpaque) -> Option<&Brush> {
     match val.as_value() {
@@ -377,6 +454,87 @@ pub extern "C" fn slint_interpreter_component_instance_set_property(
     }
 }
 
+/// Resolve the name of a property (or of a callback if `callback` is true) declared in the
+/// component, so that it can be used with the slint_interpreter_component_instance_*_resolved
+/// functions. Returns null if there is no such property or callback. Otherwise `ty` is set to the
+/// type of the property and the result must be destroyed with
+/// slint_interpreter_resolved_name_destructor.
+#[no_mangle]
+pub extern "C" fn slint_interpreter_component_definition_resolve_name(
+    def: &ComponentDefinitionOpaque,
+    name: Slice<u8>,
+    callback: bool,
+    ty: &mut ValueType,
+) -> *mut ResolvedName {
+    generativity::make_guard!(guard);
+    let description = def.as_component_definition().inner.unerase(guard);
+    let name = normalize_identifier(std::str::from_utf8(&name).unwrap());
+    match description.resolve_name(&name, callback) {
+        Some(resolved) => {
+            *ty = resolved.property_type.clone().into();
+            Box::into_raw(Box::new(resolved))
+        }
+        None => std::ptr::null_mut(),
+    }
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn slint_interpreter_resolved_name_destructor(resolved: *mut ResolvedName) {
+    drop(Box::from_raw(resolved))
+}
+
+/// Same as slint_interpreter_component_instance_get_property, with a resolved name
+#[no_mangle]
+pub unsafe extern "C" fn slint_interpreter_component_instance_get_resolved_property(
+    inst: &ErasedComponentBox,
+    resolved: &ResolvedName,
+    out: *mut ValueOpaque,
+) -> bool {
+    generativity::make_guard!(guard);
+    let comp = inst.unerase(guard);
+    match comp.description().get_resolved_property(comp.borrow(), resolved) {
+        Ok(val) => {
+            std::ptr::write(out as *mut Value, val);
+            true
+        }
+        Err(_) => false,
+    }
+}
+
+/// Same as slint_interpreter_component_instance_set_property, with a resolved name
+#[no_mangle]
+pub extern "C" fn slint_interpreter_component_instance_set_resolved_property(
+    inst: &ErasedComponentBox,
+    resolved: &ResolvedName,
+    val: &ValueOpaque,
+) -> bool {
+    generativity::make_guard!(guard);
+    let comp = inst.unerase(guard);
+    comp.description()
+        .set_resolved_property(comp.borrow(), resolved, val.as_value().clone())
+        .is_ok()
+}
+
+/// Same as slint_interpreter_component_instance_invoke_callback, with a resolved name
+#[no_mangle]
+pub unsafe extern "C" fn slint_interpreter_component_instance_invoke_resolved_callback(
+    inst: &ErasedComponentBox,
+    resolved: &ResolvedName,
+    args: Slice<ValueOpaque>,
+    out: *mut ValueOpaque,
+) -> bool {
+    let args = std::mem::transmute::<Slice<ValueOpaque>, Slice<Value>>(args);
+    generativity::make_guard!(guard);
+    let comp = inst.unerase(guard);
+    match comp.description().invoke_resolved_callback(comp.borrow(), resolved, args.as_slice()) {
+        Ok(val) => {
+            std::ptr::write(out as *mut Value, val);
+            true
+        }
+        Err(_) => false,
+    }
+}
+
 /// Wrap the user_data provided by the native code and call the drop function on Drop.
 ///
 /// Safety: user_data must be a pointer that can be destroyed by the drop_user_data function.
@@ -482,6 +640,74 @@ pub extern "C" fn slint_interpreter_component_instance_set_global_property(
         .is_ok()
 }
 
+/// A new value for a property, used by slint_interpreter_component_instance_set_properties
+/// and slint_interpreter_component_instance_set_global_properties
+#[repr(C)]
+pub struct PropertyValueUpdate<'a> {
+    /// The name of the property. Only used if `resolved` is null.
+    name: Slice<'a, u8>,
+    /// The property resolved with slint_interpreter_component_definition_resolve_name
+    resolved: Option<&'a ResolvedName>,
+    value: &'a ValueOpaque,
+}
+
+/// Sets several properties at once. Returns false if any of the properties could not be set,
+/// but still sets all the others.
+#[no_mangle]
+pub extern "C" fn slint_interpreter_component_instance_set_properties(
+    inst: &ErasedComponentBox,
+    updates: Slice<PropertyValueUpdate>,
+) -> bool {
+    generativity::make_guard!(guard);
+    let comp = inst.unerase(guard);
+    let description = comp.description();
+    let mut all_set = true;
+    for update in updates.iter() {
+        let value = update.value.as_value().clone();
+        let result = match update.resolved {
+            Some(resolved) => description.set_resolved_property(comp.borrow(), resolved, value),
+            None => description.set_property(
+                comp.borrow(),
+                &normalize_identifier(std::str::from_utf8(&update.name).unwrap()),
+                value,
+            ),
+        };
+        all_set &= result.is_ok();
+    }
+    all_set
+}
+
+/// Sets several properties of a global at once. Resolved names are not supported for globals.
+/// Returns false if the global does not exist or if any of the properties could not be set,
+/// but still sets all the others.
+#[no_mangle]
+pub extern "C" fn slint_interpreter_component_instance_set_global_properties(
+    inst: &ErasedComponentBox,
+    global: Slice<u8>,
+    updates: Slice<PropertyValueUpdate>,
+) -> bool {
+    generativity::make_guard!(guard);
+    let comp = inst.unerase(guard);
+    let g = match comp
+        .description()
+        .get_global(comp.borrow(), &normalize_identifier(std::str::from_utf8(&global).unwrap()))
+    {
+        Ok(g) => g,
+        Err(()) => return false,
+    };
+    let mut all_set = true;
+    for update in updates.iter() {
+        all_set &= update.resolved.is_none()
+            && g.as_ref()
+                .set_property(
+                    &normalize_identifier(std::str::from_utf8(&update.name).unwrap()),
+                    update.value.as_value().clone(),
+                )
+                .is_ok();
+    }
+    all_set
+}
+
 /// The `callback` function must initialize the `ret` (the `ret` passed to the callback is initialized and is assumed initialized after the function)
 #[no_mangle]
 pub unsafe extern "C" fn slint_interpreter_component_instance_set_global_callback(
@@ -657,6 +883,18 @@ fn as_model_notify(&self) -> &ModelNotify {
     notify.as_model_notify().row_changed(row);
 }
 
+#[no_mangle]
+pub unsafe extern "C" fn slint_interpreter_model_notify_rows_changed(
+    notify: &ModelNotifyOpaque,
+    row: usize,
+    count: usize,
+) {
+    let notify = notify.as_model_notify();
+    for row in row..row + count {
+        notify.row_changed(row);
+    }
+}
+
 #[no_mangle]
 pub unsafe extern "C" fn slint_interpreter_model_notify_row_added(
     notify: &ModelNotifyOpaque,
@@ -83,6 +83,8 @@
 #[doc(inline)]
 pub use api::*;
 
+pub use value_model::{NumberArrayElement, NumberArrayModel};
+
 /// (Re-export from corelib.)
 #[doc(inline)]
 pub use i_slint_core::{Brush, Color, SharedString, SharedVector};
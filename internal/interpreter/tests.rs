@@ -43,3 +43,49 @@ fn reuse_window() {
         instance
     };
 }
+
+#[test]
+fn animation_frame_callbacks() {
+    i_slint_backend_testing::init();
+    use crate::{ComponentCompiler, ComponentHandle, ComponentInstance, Value, Weak};
+    use i_slint_core::window::WindowInner;
+    use std::cell::RefCell;
+    use std::rc::Rc;
+
+    fn request_frames(instance: Weak<ComponentInstance>, ticks: Rc<RefCell<Vec<u64>>>) {
+        let component = instance.upgrade().unwrap();
+        WindowInner::from_pub(component.window()).request_animation_frame(Box::new(move |tick| {
+            ticks.borrow_mut().push(tick.0);
+            let frames = ticks.borrow().len();
+            let component = instance.upgrade().unwrap();
+            component.set_property("frames", Value::Number(frames as f64)).unwrap();
+            if frames < 3 {
+                request_frames(instance, ticks);
+            }
+        }));
+    }
+
+    let mut compiler = ComponentCompiler::default();
+    compiler.set_style("fluent".into());
+    let definition = spin_on::spin_on(compiler.build_from_source(
+        "export Test := Window { property <int> frames; }".into(),
+        Default::default(),
+    ));
+    let instance = definition.unwrap().create();
+    let window = WindowInner::from_pub(instance.window());
+
+    let ticks = Rc::new(RefCell::new(Vec::new()));
+    request_frames(instance.as_weak(), ticks.clone());
+    let cancelled = window.request_animation_frame(Box::new(|_| panic!("cancelled")));
+    window.cancel_animation_frame(cancelled);
+
+    for _ in 0..4 {
+        window.draw_contents(|_| {});
+        i_slint_core::tests::slint_mock_elapsed_time(16);
+    }
+    let ticks = ticks.borrow();
+    assert_eq!(ticks.len(), 3);
+    assert_eq!(ticks[1] - ticks[0], 16);
+    assert_eq!(ticks[2] - ticks[1], 16);
+    assert_eq!(instance.get_property("frames").unwrap(), Value::Number(3.));
+}
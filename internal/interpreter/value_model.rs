@@ -2,7 +2,8 @@
 // SPDX-License-Identifier: GPL-3.0-only OR LicenseRef-Slint-commercial
 
 use crate::api::Value;
-use i_slint_core::model::{Model, ModelTracker};
+use i_slint_core::model::{Model, ModelNotify, ModelTracker};
+use i_slint_core::SharedVector;
 use std::cell::RefCell;
 
 pub struct ValueModel {
@@ -82,3 +83,126 @@ fn as_any(&self) -> &dyn core::any::Any {
         self
     }
 }
+
+/// The types of the numbers that a [`NumberArrayModel`] can store
+pub trait NumberArrayElement: Copy + 'static {
+    /// Converts the element to the number of a [`Value::Number`]
+    fn to_number(self) -> f64;
+    /// Converts the number of a [`Value::Number`] to an element
+    fn from_number(number: f64) -> Self;
+}
+
+impl NumberArrayElement for f64 {
+    fn to_number(self) -> f64 {
+        self
+    }
+    fn from_number(number: f64) -> Self {
+        number
+    }
+}
+
+impl NumberArrayElement for f32 {
+    fn to_number(self) -> f64 {
+        self as f64
+    }
+    fn from_number(number: f64) -> Self {
+        number as f32
+    }
+}
+
+impl NumberArrayElement for i32 {
+    fn to_number(self) -> f64 {
+        self as f64
+    }
+    fn from_number(number: f64) -> Self {
+        number as i32
+    }
+}
+
+/// A model of numbers stored in one contiguous `SharedVector<T>`, whose rows are
+/// [`Value::Number`]s. The numbers are only converted to `Value`s when a row is read, so large
+/// arrays of numbers can be set on an array property and read back without a `Value` per element.
+///
+/// ```
+/// # use slint_interpreter::{NumberArrayModel, Value, SharedVector};
+/// # use i_slint_core::model::{Model, ModelRc};
+/// let samples = SharedVector::<f32>::from_slice(&[0.5, 1.5, 2.5]);
+/// let value = Value::Model(ModelRc::new(NumberArrayModel::new(samples)));
+/// if let Value::Model(model) = &value {
+///     assert_eq!(model.row_data(1), Some(Value::Number(1.5)));
+///     let model = model.as_any().downcast_ref::<NumberArrayModel<f32>>().unwrap();
+///     assert_eq!(model.data().as_slice(), &[0.5, 1.5, 2.5]);
+/// }
+/// ```
+pub struct NumberArrayModel<T> {
+    data: RefCell<SharedVector<T>>,
+    notify: ModelNotify,
+}
+
+impl<T: NumberArrayElement> NumberArrayModel<T> {
+    /// Returns a model of the numbers of `data`, which shares its buffer.
+    pub fn new(data: SharedVector<T>) -> Self {
+        Self { data: RefCell::new(data), notify: Default::default() }
+    }
+
+    /// Returns the numbers of the model, sharing its buffer.
+    pub fn data(&self) -> SharedVector<T> {
+        self.data.borrow().clone()
+    }
+
+    /// Replaces all the numbers of the model.
+    pub fn set_data(&self, data: SharedVector<T>) {
+        *self.data.borrow_mut() = data;
+        self.notify.reset();
+    }
+}
+
+impl<T: NumberArrayElement> Model for NumberArrayModel<T> {
+    type Data = Value;
+
+    fn row_count(&self) -> usize {
+        self.data.borrow().len()
+    }
+
+    fn row_data(&self, row: usize) -> Option<Self::Data> {
+        self.data.borrow().get(row).map(|x| Value::Number(x.to_number()))
+    }
+
+    fn set_row_data(&self, row: usize, data: Self::Data) {
+        match data {
+            Value::Number(number) => {
+                if row < self.row_count() {
+                    self.data.borrow_mut().make_mut_slice()[row] = T::from_number(number);
+                    self.notify.row_changed(row);
+                }
+            }
+            _ => eprintln!("Trying to set a value that is not a number in a model of numbers."),
+        }
+    }
+
+    fn model_tracker(&self) -> &dyn ModelTracker {
+        &self.notify
+    }
+
+    fn as_any(&self) -> &dyn core::any::Any {
+        self
+    }
+}
+
+/// Returns the numbers of the model, sharing the buffer if it is a [`NumberArrayModel<T>`],
+/// or None if one of the rows is not a number.
+pub(crate) fn to_number_array<T: NumberArrayElement>(
+    model: &dyn Model<Data = Value>,
+) -> Option<SharedVector<T>> {
+    if let Some(model) = model.as_any().downcast_ref::<NumberArrayModel<T>>() {
+        return Some(model.data());
+    }
+    let mut data = SharedVector::with_capacity(model.row_count());
+    for row in 0..model.row_count() {
+        match model.row_data(row)? {
+            Value::Number(number) => data.push(T::from_number(number)),
+            _ => return None,
+        }
+    }
+    Some(data)
+}
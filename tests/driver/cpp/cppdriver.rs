@@ -6,6 +6,15 @@
 use std::io::Write;
 use std::ops::Deref;
 
+/// The test cases in these directories of tests/cases are compiled with the definitions of the
+/// generated code moved out of the header into .cpp files, which checks that the header declares
+/// everything the .cpp files and the test need, and that `inline` and `extern` link.
+const SPLIT_CPP_DIRECTORIES: &[&str] =
+    &["examples", "globals", "imports", "models", "subcomponents"];
+
+/// The number of .cpp files of the test cases in SPLIT_CPP_DIRECTORIES
+const SPLIT_CPP_FILE_COUNT: usize = 2;
+
 pub fn test(testcase: &test_driver_lib::TestCase) -> Result<(), Box<dyn Error>> {
     let source = std::fs::read_to_string(&testcase.absolute_path)?;
 
@@ -15,7 +24,8 @@ pub fn test(testcase: &test_driver_lib::TestCase) -> Result<(), Box<dyn Error>>
 
     let mut diag = BuildDiagnostics::default();
     let syntax_node = parser::parse(source.clone(), Some(&testcase.absolute_path), &mut diag);
-    let mut compiler_config = CompilerConfiguration::new(generator::OutputFormat::Cpp);
+    let mut compiler_config =
+        CompilerConfiguration::new(generator::OutputFormat::Cpp(Default::default()));
     compiler_config.include_paths = include_paths;
     let (root_component, diag) =
         spin_on::spin_on(compile_syntax_node(syntax_node, diag, compiler_config));
@@ -25,15 +35,41 @@ pub fn test(testcase: &test_driver_lib::TestCase) -> Result<(), Box<dyn Error>>
         return Err(vec.join("\n").into());
     }
 
+    let split_cpp = testcase.relative_path.components().next().map_or(false, |dir| {
+        SPLIT_CPP_DIRECTORIES.iter().any(|split_dir| dir.as_os_str() == *split_dir)
+    });
+    let temp_dir = tempfile::tempdir()?;
+    let header_name = "generated.h";
+    let config = generator::cpp::Config {
+        cpp_file_count: if split_cpp { SPLIT_CPP_FILE_COUNT } else { 0 },
+        header_include: header_name.into(),
+    };
+
     let mut generated_cpp: Vec<u8> = Vec::new();
+    let mut generated_header: Vec<u8> = Vec::new();
 
-    generator::generate(generator::OutputFormat::Cpp, &mut generated_cpp, &root_component)?;
+    let other_files = generator::generate(
+        generator::OutputFormat::Cpp(config),
+        if split_cpp { &mut generated_header } else { &mut generated_cpp },
+        &root_component,
+    )?;
 
     if diag.has_error() {
         let vec = diag.to_string_vec();
         return Err(vec.join("\n").into());
     }
 
+    let mut other_cpp_files = Vec::new();
+    if split_cpp {
+        std::fs::write(temp_dir.path().join(header_name), &generated_header)?;
+        for (i, contents) in other_files.iter().enumerate() {
+            let path = temp_dir.path().join(format!("generated_{}.cpp", i + 1));
+            std::fs::write(&path, contents)?;
+            other_cpp_files.push(path);
+        }
+        writeln!(generated_cpp, "#include \"{}\"", header_name)?;
+    }
+
     generated_cpp.write_all(
         br"
 #ifdef NDEBUG
@@ -74,6 +110,7 @@ pub fn test(testcase: &test_driver_lib::TestCase) -> Result<(), Box<dyn Error>>
         .host(env!("HOST"))
         .include(env!("GENERATED_CPP_HEADERS_PATH"))
         .include(env!("CPP_API_HEADERS_PATH"))
+        .include(temp_dir.path())
         .try_get_compiler()?;
 
     let mut compiler_command = compiler.to_command();
@@ -89,6 +126,7 @@ pub fn test(testcase: &test_driver_lib::TestCase) -> Result<(), Box<dyn Error>>
     });
 
     compiler_command.arg(&*cpp_file);
+    compiler_command.args(&other_cpp_files);
 
     if keep_temp_files {
         println!(
@@ -97,7 +135,11 @@ pub fn test(testcase: &test_driver_lib::TestCase) -> Result<(), Box<dyn Error>>
             cpp_file.display(),
             binary_path.display()
         );
+        if split_cpp {
+            println!("  generated header and .cpp files in {}", temp_dir.path().display());
+        }
         cpp_file.keep()?;
+        let _ = temp_dir.into_path();
     }
 
     if compiler.is_like_clang() || compiler.is_like_gnu() {
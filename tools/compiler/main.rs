@@ -32,11 +32,38 @@ struct Cli {
     /// Sets the output file ('-' for stdout)
     #[arg(name = "file to generate", short = 'o', default_value = "-", action)]
     output: std::path::PathBuf,
+
+    /// With the cpp format, moves the definitions out of the header into this .cpp file.
+    /// Can be repeated to split the definitions among several files. The header must then
+    /// be written to a file with -o.
+    #[arg(long = "cpp-file", name = "cpp file", number_of_values = 1, action)]
+    cpp_files: Vec<std::path::PathBuf>,
 }
 
 fn main() -> std::io::Result<()> {
     proc_macro2::fallback::force(); // avoid a abort if panic=abort is set
-    let args = Cli::parse();
+    let mut args = Cli::parse();
+    let writes_to_stdout = args.output == std::path::Path::new("-");
+    if !args.cpp_files.is_empty() {
+        if writes_to_stdout {
+            eprintln!("--cpp-file requires the header to be written to a file with -o");
+            std::process::exit(-1);
+        }
+        match &mut args.format {
+            generator::OutputFormat::Cpp(config) => {
+                config.cpp_file_count = args.cpp_files.len();
+                config.header_include = args
+                    .output
+                    .file_name()
+                    .map(|name| name.to_string_lossy().into_owned())
+                    .unwrap_or_default();
+            }
+            _ => {
+                eprintln!("--cpp-file can only be used with the cpp format");
+                std::process::exit(-1);
+            }
+        }
+    }
     let mut diag = BuildDiagnostics::default();
     let syntax_node = parser::parse_file(&args.path, &mut diag);
     //println!("{:#?}", syntax_node);
@@ -44,7 +71,7 @@ fn main() -> std::io::Result<()> {
         diag.print();
         std::process::exit(-1);
     }
-    let mut compiler_config = CompilerConfiguration::new(args.format);
+    let mut compiler_config = CompilerConfiguration::new(args.format.clone());
     compiler_config.include_paths = args.include_paths;
     if let Some(style) = args.style {
         compiler_config.style = Some(style);
@@ -54,10 +81,15 @@ fn main() -> std::io::Result<()> {
 
     let diag = diag.check_and_exit_on_error();
 
-    if args.output == std::path::Path::new("-") {
+    if writes_to_stdout {
         generator::generate(args.format, &mut std::io::stdout(), &doc)?;
     } else {
-        generator::generate(args.format, &mut std::fs::File::create(&args.output)?, &doc)?;
+        let other_files =
+            generator::generate(args.format, &mut std::fs::File::create(&args.output)?, &doc)?;
+        // An empty document produces no .cpp file, but the build system still expects them
+        for (i, path) in args.cpp_files.iter().enumerate() {
+            std::fs::write(path, other_files.get(i).map_or("", String::as_str))?;
+        }
     }
 
     if let Some(depfile) = args.depfile {